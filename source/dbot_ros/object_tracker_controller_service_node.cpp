@@ -29,6 +29,7 @@
 #include <dbot_ros/util/interactive_marker_initializer.h>
 #include <dbot_ros/util/ros_camera_data_provider.h>
 #include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/tracker_config.h>
 #include <dbot_ros_msgs/FindObject.h>
 #include <dbot_ros_msgs/RunObjectTracker.h>
 #include <dbot_ros_msgs/TrackObject.h>
@@ -48,16 +49,15 @@ static ros::ServiceClient object_tracker_service_client;
 
 static dbot_ros_msgs::TrackObjectRequest last_req;
 
+// read once at startup, the request handlers use this copy
+static dbot::ObjectConfig objects;
+
 bool stop_object_tracker()
 {
-    ros::NodeHandle nh_prv("~");
-    auto objects_package   = ri::read<std::string>("objects/package", nh_prv);
-    auto objects_directory = ri::read<std::string>("objects/directory", nh_prv);
-
     dbot_ros_msgs::RunObjectTracker run_object_tracker_srv;
-    run_object_tracker_srv.request.object_state.ori.package = objects_package;
+    run_object_tracker_srv.request.object_state.ori.package = objects.package;
     run_object_tracker_srv.request.object_state.ori.directory =
-        objects_directory;
+        objects.directory;
     run_object_tracker_srv.request.object_state.ori.name = "stop";
     run_object_tracker_srv.request.object_state.name     = "stop";
 
@@ -95,17 +95,11 @@ void marker_callback(const geometry_msgs::PoseArray& poses)
     pose.pose = object_initializer->poses()[0];
 
 
-    // find new pose
-    ros::NodeHandle nh_prv("~");
-    auto objects_package   = ri::read<std::string>("objects/package", nh_prv);
-    auto objects_directory = ri::read<std::string>("objects/directory", nh_prv);
-
-
     // trigger tracking
     dbot_ros_msgs::RunObjectTracker run_object_tracker_srv;
-    run_object_tracker_srv.request.object_state.ori.package = objects_package;
+    run_object_tracker_srv.request.object_state.ori.package = objects.package;
     run_object_tracker_srv.request.object_state.ori.directory =
-        objects_directory;
+        objects.directory;
     run_object_tracker_srv.request.object_state.ori.name =
         last_req.object_name + ".obj";
     run_object_tracker_srv.request.object_state.name = last_req.object_name;
@@ -133,18 +127,13 @@ bool track_object_srv(dbot_ros_msgs::TrackObjectRequest& req,
     //        return false;
     //   }
 
-    // find new pose
-    ros::NodeHandle nh_prv("~");
-    auto objects_package   = ri::read<std::string>("objects/package", nh_prv);
-    auto objects_directory = ri::read<std::string>("objects/directory", nh_prv);
-
     geometry_msgs::PoseStamped pose;
 
     if (req.auto_detect)
     {
         dbot_ros_msgs::FindObject find_object_srv;
-        find_object_srv.request.object_ori.package   = objects_package;
-        find_object_srv.request.object_ori.directory = objects_directory;
+        find_object_srv.request.object_ori.package   = objects.package;
+        find_object_srv.request.object_ori.directory = objects.directory;
         find_object_srv.request.object_ori.name      = req.object_name + ".obj";
         if (!object_finder_service_client.call(find_object_srv))
         {
@@ -167,8 +156,8 @@ bool track_object_srv(dbot_ros_msgs::TrackObjectRequest& req,
     }
     else
     {
-        object_initializer->set_objects(objects_package,
-                                        objects_directory,
+        object_initializer->set_objects(objects.package,
+                                        objects.directory,
                                         {req.object_name + ".obj"},
                                         {},
                                         true,
@@ -196,9 +185,9 @@ bool track_object_srv(dbot_ros_msgs::TrackObjectRequest& req,
 
     // trigger tracking
     dbot_ros_msgs::RunObjectTracker run_object_tracker_srv;
-    run_object_tracker_srv.request.object_state.ori.package = objects_package;
+    run_object_tracker_srv.request.object_state.ori.package = objects.package;
     run_object_tracker_srv.request.object_state.ori.directory =
-        objects_directory;
+        objects.directory;
     run_object_tracker_srv.request.object_state.ori.name =
         req.object_name + ".obj";
     run_object_tracker_srv.request.object_state.name = req.object_name;
@@ -222,15 +211,20 @@ int main(int argc, char** argv)
     ros::NodeHandle nh;
     ros::NodeHandle nh_prv("~");
 
-
-    auto object_tracker_controller_service_name =
-        ri::read<std::string>("object_tracker_controller_service_name", nh_prv);
-    auto object_tracker_service_name =
-        ri::read<std::string>("object_tracker_service_name", nh_prv);
-    auto object_finder_service_name =
-        ri::read<std::string>("object_finder_service_name", nh_prv);
-
-    auto camera_info_topic = ri::read<std::string>("camera_info_topic", nh_prv);
+    dbot::ParameterReader reader(nh_prv);
+    std::string object_tracker_controller_service_name;
+    std::string object_tracker_service_name;
+    std::string object_finder_service_name;
+    std::string camera_info_topic;
+    reader.required("object_tracker_controller_service_name",
+                    object_tracker_controller_service_name);
+    reader.required("object_tracker_service_name",
+                    object_tracker_service_name);
+    reader.required("object_finder_service_name", object_finder_service_name);
+    reader.required("camera_info_topic", camera_info_topic);
+    reader.required("objects/package", objects.package);
+    reader.required("objects/directory", objects.directory);
+    if (!reader.report()) return 1;
 
     auto camera_frame = ri::get_camera_frame(camera_info_topic, nh, 5.);
 
@@ -0,0 +1,27 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file object_tracker_node.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot/tracker/gaussian_tracker.h>
+#include <dbot/tracker/particle_tracker.h>
+#include <dbot_ros/object_tracker_node.h>
+#include <dbot_ros/object_tracker_node.hpp>
+
+namespace dbot
+{
+template class ObjectTrackerNode<ParticleTracker>;
+template class ObjectTrackerNode<GaussianTracker>;
+}
@@ -0,0 +1,117 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file object_tracker_node.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/object_tracker_publisher.h>
+#include <dbot_ros/object_tracker_ros.h>
+#include <dbot_ros/predicted_state_publisher.h>
+#include <dbot_ros/util/belief_checkpoint.h>
+#include <dbot_ros/util/shared_pose_channel.h>
+#include <dbot_ros/util/startup_timeline.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/tracker_reloader.h>
+#include <functional>
+#include <memory>
+#include <ros/ros.h>
+#include <sensor_msgs/CameraInfo.h>
+#include <string>
+
+namespace dbot
+{
+/**
+ * \brief Runs an initialized ObjectTrackerRos within a tracker node along
+ * with the optional runtime features of runtime.yaml, i.e. the predicted
+ * state publisher, the belief checkpoint, the shared pose channel, the
+ * session and flight recorders and the ~reinitialize service.
+ *
+ * The features are set up on construction according to the RuntimeConfig.
+ * Disabled features cost nothing while tracking.
+ */
+template <typename Tracker>
+class ObjectTrackerNode
+{
+public:
+    /**
+     * \brief Builds a tracker from the current parameters, see
+     *        TrackerReloader
+     */
+    typedef typename TrackerReloader<Tracker>::Build Build;
+
+public:
+    /**
+     * \brief Sets up the enabled runtime features
+     * \param node_handle
+     * 			Private node handle the services are advertised on
+     * \param object_tracker
+     * 			Initialized tracker. It must outlive the node.
+     * \param publisher
+     * 			Publisher of the estimates. It must outlive the node.
+     * \param camera_info
+     * 			Camera info written by the session and flight recorders
+     */
+    ObjectTrackerNode(ros::NodeHandle& node_handle,
+                      ObjectTrackerRos<Tracker>& object_tracker,
+                      ObjectStatePublisher& publisher,
+                      const ObjectResourceIdentifier& ori,
+                      const RuntimeConfig& config,
+                      const sensor_msgs::CameraInfo& camera_info);
+
+    /**
+     * \brief Advertises ~reinitialize, which rebuilds the tracker via
+     *        \c build and initializes it at the current estimate
+     * \param background
+     * 			Whether the tracker is built on a background thread, see
+     * 			TrackerReloader
+     */
+    void reinitializable(const Build& build, bool background = true);
+
+    /**
+     * \brief Sets the startup timeline which is notified of the first
+     *        published estimate
+     */
+    void startup_timeline(StartupTimeline& timeline);
+
+    /**
+     * \brief Tracks the images of \c depth_image_topic and publishes the
+     *        estimates until ROS shuts down or \c keep_running returns false
+     */
+    void run(const std::string& depth_image_topic,
+             const std::function<bool()>& keep_running =
+                 std::function<bool()>());
+
+private:
+    /**
+     * \brief Passes the estimates of the last tracked frame on to the
+     *        publishers and the enabled features
+     */
+    void publish();
+
+private:
+    ros::NodeHandle node_handle_;
+    ObjectTrackerRos<Tracker>& object_tracker_;
+    ObjectStatePublisher& publisher_;
+    StartupTimeline* startup_timeline_;
+    std::shared_ptr<PredictedStatePublisher> predicted_publisher_;
+    std::shared_ptr<BeliefCheckpoint> belief_checkpoint_;
+    std::shared_ptr<SharedPoseChannelWriter> pose_channel_;
+    std::shared_ptr<TrackerReloader<Tracker>> reloader_;
+    ros::ServiceServer flight_recorder_srv_;
+    ros::ServiceServer reinitialize_srv_;
+};
+}
@@ -0,0 +1,168 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file object_tracker_node.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <dbot_ros/object_tracker_node.h>
+#include <dbot_ros/util/flight_recorder.h>
+#include <dbot_ros/util/object_state_conversion.h>
+#include <dbot_ros/util/session_recorder.h>
+#include <dbot_ros/util/session_writer.h>
+#include <unistd.h>
+
+namespace dbot
+{
+template <typename Tracker>
+ObjectTrackerNode<Tracker>::ObjectTrackerNode(
+    ros::NodeHandle& node_handle,
+    ObjectTrackerRos<Tracker>& object_tracker,
+    ObjectStatePublisher& publisher,
+    const ObjectResourceIdentifier& ori,
+    const RuntimeConfig& config,
+    const sensor_msgs::CameraInfo& camera_info)
+    : node_handle_(node_handle),
+      object_tracker_(object_tracker),
+      publisher_(publisher),
+      startup_timeline_(nullptr)
+{
+    /* ------------------------------ */
+    /* - Predicted state output     - */
+    /* ------------------------------ */
+    if (config.predict_states)
+    {
+        predicted_publisher_ = std::make_shared<PredictedStatePublisher>(
+            ori, config.predicted_state_publisher);
+    }
+
+    /* ------------------------------ */
+    /* - Belief checkpoint          - */
+    /* ------------------------------ */
+    if (config.checkpoint_belief)
+    {
+        belief_checkpoint_ =
+            std::make_shared<BeliefCheckpoint>(ori, config.belief_checkpoint);
+    }
+
+    /* ------------------------------ */
+    /* - Shared memory pose channel - */
+    /* ------------------------------ */
+    if (config.share_poses)
+    {
+        pose_channel_ = std::make_shared<SharedPoseChannelWriter>(
+            config.shared_pose_channel_name, ori.count_meshes());
+        if (!pose_channel_->is_open()) pose_channel_.reset();
+    }
+
+    /* ------------------------------ */
+    /* - Session recording          - */
+    /* ------------------------------ */
+    if (config.record_session)
+    {
+        object_tracker_.session_recorder(std::make_shared<SessionRecorder>(
+            SessionWriter::unique_directory(config.session_path, "session"),
+            camera_info,
+            config.session_queue_size));
+    }
+
+    /* ------------------------------ */
+    /* - Flight recorder            - */
+    /* ------------------------------ */
+    if (config.use_flight_recorder)
+    {
+        auto flight_recorder = std::make_shared<FlightRecorder>(
+            config.flight_recorder, camera_info, ori.count_meshes());
+        flight_recorder_srv_ =
+            node_handle_.advertiseService("dump_flight_recorder",
+                                          &FlightRecorder::trigger_srv,
+                                          flight_recorder.get());
+        object_tracker_.flight_recorder(flight_recorder);
+    }
+}
+
+template <typename Tracker>
+void ObjectTrackerNode<Tracker>::reinitializable(const Build& build,
+                                                 bool background)
+{
+    reloader_ = std::make_shared<TrackerReloader<Tracker>>(build, background);
+    reinitialize_srv_ =
+        node_handle_.advertiseService("reinitialize",
+                                      &TrackerReloader<Tracker>::reload_srv,
+                                      reloader_.get());
+}
+
+template <typename Tracker>
+void ObjectTrackerNode<Tracker>::startup_timeline(StartupTimeline& timeline)
+{
+    startup_timeline_ = &timeline;
+}
+
+template <typename Tracker>
+void ObjectTrackerNode<Tracker>::run(
+    const std::string& depth_image_topic,
+    const std::function<bool()>& keep_running)
+{
+    ros::Subscriber subscriber =
+        node_handle_.subscribe(depth_image_topic,
+                               1,
+                               &ObjectTrackerRos<Tracker>::update_obsrv,
+                               &object_tracker_);
+    (void)subscriber;
+
+    while (ros::ok() && (!keep_running || keep_running()))
+    {
+        auto rebuilt_tracker =
+            reloader_ ? reloader_->rebuilt() : std::shared_ptr<Tracker>();
+        if (rebuilt_tracker)
+        {
+            object_tracker_.reinitialize(rebuilt_tracker);
+            ROS_WARN(
+                "Tracker parameters reloaded, the tracker was initialized at "
+                "the current estimate");
+        }
+
+        if (!object_tracker_.run_once())
+        {
+            usleep(100);
+            continue;
+        }
+
+        publish();
+    }
+}
+
+template <typename Tracker>
+void ObjectTrackerNode<Tracker>::publish()
+{
+    const auto& states = object_tracker_.current_state_messages();
+    publisher_.publish(states);
+    if (startup_timeline_) startup_timeline_->first_pose();
+
+    if (predicted_publisher_)
+    {
+        predicted_publisher_->update(states,
+                                     object_tracker_.current_step_duration());
+    }
+
+    if (belief_checkpoint_) belief_checkpoint_->update(states);
+
+    if (pose_channel_ && !states.empty())
+    {
+        pose_channel_->write(states[0].pose.header.stamp.toNSec(),
+                             ri::to_shared_poses(states));
+    }
+}
+}
@@ -19,6 +19,8 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
 #include <dbot/pose/euler_vector.h>
 #include <dbot/pose/free_floating_rigid_bodies_state.h>
 #include <dbot/pose/pose_vector.h>
@@ -27,6 +29,7 @@
 #include <dbot_ros/util/ros_interface.h>
 #include <dbot_ros_msgs/ObjectState.h>
 #include <visualization_msgs/Marker.h>
+#include <visualization_msgs/MarkerArray.h>
 
 namespace dbot
 {
@@ -34,40 +37,247 @@ ObjectStatePublisher::ObjectStatePublisher(
     const dbot::ObjectResourceIdentifier& ori,
     int object_color_red,
     int object_color_green,
-    int object_color_blue)
+    int object_color_blue,
+    const Parameters& params)
     : node_handle_("~"),
       ori_(ori),
+      params_(params),
       object_color_red_(object_color_red),
       object_color_green_(object_color_green),
       object_color_blue_(object_color_blue)
 {
-    object_marker_publisher_ =
-        node_handle_.advertise<visualization_msgs::Marker>("object_model", 0);
-    object_state_publisher_ =
-        node_handle_.advertise<dbot_ros_msgs::ObjectState>("object_state", 0);
+    if (params_.per_object)
+    {
+        object_marker_publisher_ =
+            node_handle_.advertise<visualization_msgs::Marker>("object_model",
+                                                               0);
+        object_state_publisher_ =
+            node_handle_.advertise<dbot_ros_msgs::ObjectState>("object_state",
+                                                               0);
+    }
+
+    if (params_.batched)
+    {
+        object_markers_publisher_ =
+            node_handle_.advertise<visualization_msgs::MarkerArray>(
+                "object_models", 0);
+        object_states_publisher_ =
+            node_handle_.advertise<dbot_ros::ObjectStateArray>("object_states",
+                                                               0);
+    }
+
+    // the static message fields, e.g. names and mesh resources, are set once
+    // such that publishing only patches the pose, velocity and header
+    for (int i = 0; i < ori_.count_meshes(); i++)
+    {
+        dbot_ros_msgs::ObjectState object_state;
+        object_state.name          = ori_.mesh_without_extension(i);
+        object_state.ori.name      = ori_.mesh(i);
+        object_state.ori.directory = ori_.directory();
+        object_state.ori.package   = ori_.package();
+        object_states_.states.push_back(object_state);
+        last_poses_.push_back(geometry_msgs::Pose());
+        last_state_times_.push_back(ros::WallTime());
+
+        markers_.markers.push_back(
+            ri::make_marker(geometry_msgs::PoseStamped(),
+                            ori_.mesh_uri(i),
+                            i,
+                            object_color_red_ / 255.,
+                            object_color_green_ / 255.,
+                            object_color_blue_ / 255.));
+    }
+
+    if (params_.tf)
+    {
+        tf_broadcaster_ = std::make_shared<tf::TransformBroadcaster>();
+
+        for (int i = 0; i < ori_.count_meshes(); i++)
+        {
+            auto name = ori_.mesh_without_extension(i);
+            int count = 0;
+            for (int j = 0; j < ori_.count_meshes(); j++)
+            {
+                if (ori_.mesh_without_extension(j) == name) ++count;
+            }
+
+            geometry_msgs::TransformStamped transform;
+            transform.child_frame_id = params_.tf_prefix + name;
+            if (count > 1) transform.child_frame_id += std::to_string(i);
+            transforms_.push_back(transform);
+        }
+    }
 }
 
 void ObjectStatePublisher::publish(
     const std::vector<dbot_ros_msgs::ObjectState>& states)
 
 {
+    bool publish_marker  = false;
+    bool publish_markers = false;
+    if (markers_due())
+    {
+        publish_marker  = params_.per_object &&
+                         object_marker_publisher_.getNumSubscribers() > 0;
+        publish_markers = params_.batched &&
+                          object_markers_publisher_.getNumSubscribers() > 0;
+    }
+
+    // with latency compensation, the estimates are predicted to the time of
+    // publishing, i.e. by the time passed since the image was taken. The
+    // velocities are displacements per filter step, i.e. per tracked image
+    ros::Time now;
+    double compensation  = 0.0;
+    double step_duration = ri::default_frame_period;
+    if (params_.latency_compensation && !states.empty())
+    {
+        auto& stamp   = states[0].pose.header.stamp;
+        now           = ros::Time::now();
+        compensation  = std::max(0.0, (now - stamp).toSec());
+        step_duration = ri::step_duration(last_stamp_, stamp);
+        last_stamp_   = stamp;
+    }
+
+    // the array is published if any of its objects is due
+    bool publish_states = false;
+
     for (int i = 0; i < ori_.count_meshes(); i++)
     {
-        ri::publish_marker(states[i].pose,
-                           ori_.mesh_uri(i),
-                           object_marker_publisher_,
-                           i,
-                           object_color_red_ / 255.,
-                           object_color_green_ / 255.,
-                           object_color_blue_ / 255.);
-
-
-        dbot_ros_msgs::ObjectState object_state_message = states[i];
-        object_state_message.name          = ori_.mesh_without_extension(i);
-        object_state_message.ori.name      = ori_.mesh(i);
-        object_state_message.ori.directory = ori_.directory();
-        object_state_message.ori.package   = ori_.package();
-        object_state_publisher_.publish(object_state_message);
+        auto& object_state    = object_states_.states[i];
+        object_state.pose     = states[i].pose;
+        object_state.velocity = states[i].velocity;
+        if (params_.latency_compensation)
+        {
+            object_state.pose.pose = ri::extrapolate(
+                states[i].pose.pose,
+                ri::to_ros_velocity(states[i].velocity.twist, step_duration),
+                compensation);
+            object_state.pose.header.stamp     = now;
+            object_state.velocity.header.stamp = now;
+        }
+
+        bool publish_state = state_due(i, object_state.pose.pose);
+        publish_states     = publish_states || publish_state;
+
+        // only the dynamic marker fields are updated
+        auto& marker = markers_.markers[i];
+        if (publish_marker || publish_markers)
+        {
+            marker.header = object_state.pose.header;
+            marker.pose   = object_state.pose.pose;
+        }
+
+        if (tf_broadcaster_)
+        {
+            auto& transform  = transforms_[i];
+            transform.header = object_state.pose.header;
+
+            auto& translation = transform.transform.translation;
+            auto& position    = object_state.pose.pose.position;
+            translation.x     = position.x;
+            translation.y     = position.y;
+            translation.z     = position.z;
+
+            transform.transform.rotation = object_state.pose.pose.orientation;
+        }
+
+        if (params_.per_object)
+        {
+            if (publish_marker) object_marker_publisher_.publish(marker);
+            if (publish_state) object_state_publisher_.publish(object_state);
+        }
+    }
+
+    // transforms are sent every frame regardless of the deadband, such that
+    // tf can interpolate
+    if (tf_broadcaster_ && !states.empty())
+    {
+        tf_broadcaster_->sendTransform(transforms_);
     }
+
+    if (params_.batched && !states.empty())
+    {
+        object_states_.header        = object_states_.states[0].pose.header;
+        object_states_.predicted     = params_.latency_compensation;
+        object_states_.extrapolation = ros::Duration(compensation);
+        if (publish_markers) object_markers_publisher_.publish(markers_);
+        if (publish_states) object_states_publisher_.publish(object_states_);
+    }
+}
+
+bool ObjectStatePublisher::markers_due()
+{
+    bool subscribed =
+        (params_.per_object &&
+         object_marker_publisher_.getNumSubscribers() > 0) ||
+        (params_.batched && object_markers_publisher_.getNumSubscribers() > 0);
+
+    // nobody watches, skip building and serializing the markers entirely
+    if (!subscribed) return false;
+
+    if (params_.marker_rate > 0.0)
+    {
+        auto now = ros::WallTime::now();
+        if ((now - last_marker_time_).toSec() < 1.0 / params_.marker_rate)
+        {
+            return false;
+        }
+        last_marker_time_ = now;
+    }
+
+    return true;
+}
+
+bool ObjectStatePublisher::state_due(int i, const geometry_msgs::Pose& pose)
+{
+    if (params_.deadband_translation <= 0.0 && params_.deadband_rotation <= 0.0)
+    {
+        return true;
+    }
+
+    auto now = ros::WallTime::now();
+    bool due = last_state_times_[i].isZero();
+
+    if (!due && params_.keep_alive_rate > 0.0)
+    {
+        due = (now - last_state_times_[i]).toSec() >=
+              1.0 / params_.keep_alive_rate;
+    }
+
+    // once the deadband is enabled, a zero threshold publishes any change on
+    // its axis
+    if (!due)
+    {
+        auto& last = last_poses_[i].position;
+        double dx  = pose.position.x - last.x;
+        double dy  = pose.position.y - last.y;
+        double dz  = pose.position.z - last.z;
+        due = std::sqrt(dx * dx + dy * dy + dz * dz) >
+              params_.deadband_translation;
+    }
+
+    if (!due)
+    {
+        // angle of the rotation conj(a) * b from the last published
+        // orientation a to b. Unlike acos of the dot product, this is
+        // exactly zero for an unchanged orientation
+        auto& a  = last_poses_[i].orientation;
+        auto& b  = pose.orientation;
+        double w = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+        double x = a.w * b.x - b.w * a.x - (a.y * b.z - a.z * b.y);
+        double y = a.w * b.y - b.w * a.y - (a.z * b.x - a.x * b.z);
+        double z = a.w * b.z - b.w * a.z - (a.x * b.y - a.y * b.x);
+        double angle =
+            2.0 * std::atan2(std::sqrt(x * x + y * y + z * z), std::fabs(w));
+        due = angle > params_.deadband_rotation;
+    }
+
+    if (due)
+    {
+        last_poses_[i]       = pose;
+        last_state_times_[i] = now;
+    }
+
+    return due;
 }
 }
@@ -22,11 +22,18 @@
 #include <dbot/camera_data.h>
 #include <dbot/object_model.h>
 #include <dbot/object_resource_identifier.h>
+#include <dbot_ros/ObjectStateArray.h>
+#include <dbot_ros/util/runtime_parameters.h>
 #include <dbot_ros_msgs/ObjectState.h>
 #include <geometry_msgs/PoseStamped.h>
+#include <geometry_msgs/TransformStamped.h>
+#include <memory>
 #include <ros/ros.h>
 #include <sensor_msgs/Image.h>
+#include <string>
+#include <tf/transform_broadcaster.h>
 #include <vector>
+#include <visualization_msgs/MarkerArray.h>
 
 namespace dbot
 {
@@ -36,19 +43,47 @@ namespace dbot
  */
 class ObjectStatePublisher
 {
+public:
+    typedef ObjectStatePublisherParameters Parameters;
+
 public:
     ObjectStatePublisher(const dbot::ObjectResourceIdentifier& ori,
                          int object_color_red,
                          int object_color_green,
-                         int object_color_blue);
+                         int object_color_blue,
+                         const Parameters& params = Parameters());
 
     void publish(const std::vector<dbot_ros_msgs::ObjectState>& state);
 
+protected:
+    /**
+     * \brief Returns whether markers are subscribed and due according to the
+     *        marker rate
+     */
+    bool markers_due();
+
+    /**
+     * \brief Returns whether the state of object \c i left the deadband or
+     *        its keep-alive is due
+     */
+    bool state_due(int i, const geometry_msgs::Pose& pose);
+
 protected:
     ros::NodeHandle node_handle_;
     ros::Publisher object_marker_publisher_;
     ros::Publisher object_state_publisher_;
+    ros::Publisher object_markers_publisher_;
+    ros::Publisher object_states_publisher_;
     dbot::ObjectResourceIdentifier ori_;
+    Parameters params_;
+    dbot_ros::ObjectStateArray object_states_;
+    visualization_msgs::MarkerArray markers_;
+    ros::WallTime last_marker_time_;
+    ros::Time last_stamp_;
+    std::vector<geometry_msgs::Pose> last_poses_;
+    std::vector<ros::WallTime> last_state_times_;
+    std::shared_ptr<tf::TransformBroadcaster> tf_broadcaster_;
+    std::vector<geometry_msgs::TransformStamped> transforms_;
     int object_color_red_;
     int object_color_green_;
     int object_color_blue_;
@@ -20,6 +20,8 @@
 #pragma once
 
 #include <dbot/camera_data.h>
+#include <dbot_ros/util/flight_recorder.h>
+#include <dbot_ros/util/session_recorder.h>
 #include <dbot_ros_msgs/ObjectState.h>
 #include <geometry_msgs/PoseStamped.h>
 #include <geometry_msgs/TwistStamped.h>
@@ -54,8 +56,21 @@ public:
      */
     void track(const sensor_msgs::Image& ros_image);
 
+    /**
+     * \brief Initializes the tracker. The initial state is the current state
+     *        until the first image is tracked
+     */
     void initialize(const std::vector<State>& initial_states);
 
+    /**
+     * \brief Replaces the tracker, e.g. after its parameters have been
+     *        reloaded, and initializes the new tracker at the current state.
+     *        The dbot trackers do not expose their belief, i.e. the particle
+     *        set or the covariance of the replaced tracker is not carried
+     *        over. Must be called between two frames by the tracking thread
+     */
+    void reinitialize(const std::shared_ptr<Tracker>& tracker);
+
     /**
      * \brief Incoming observation callback function
      * \param ros_image new observation
@@ -67,23 +82,55 @@ public:
 
     State current_state() const;
     geometry_msgs::PoseStamped current_pose() const;
-    std::vector<dbot_ros_msgs::ObjectState> current_state_messages() const;
+
+    /**
+     * \brief Returns the estimates of the last tracked frame. The reference
+     *        remains valid, and is updated in place, by subsequent frames.
+     *        The velocities are the displacements [m] and [rad] of the
+     *        last filter step
+     */
+    const std::vector<dbot_ros_msgs::ObjectState>& current_state_messages()
+        const;
+
+    /**
+     * \brief Returns the duration [s] of the last filter step, i.e. the time
+     *        between the last two tracked images
+     */
+    double current_step_duration() const;
+
     std::vector<geometry_msgs::PoseStamped> current_poses() const;
 
     const std::shared_ptr<Tracker>& tracker() { return tracker_; }
     void shutdown();
 
+    /**
+     * \brief Sets the recorder which receives every tracked image along with
+     *        the estimated object states
+     */
+    void session_recorder(const std::shared_ptr<SessionRecorder>& recorder);
+
+    /**
+     * \brief Sets the flight recorder which keeps the most recent images and
+     *        estimates along with the tracking latency
+     */
+    void flight_recorder(const std::shared_ptr<FlightRecorder>& recorder);
+
 protected:
     bool obsrv_updated_;
     bool running_;
     State current_state_;
     double current_time_;
+    ros::Time last_stamp_;
+    double step_duration_;
     int object_count_;
     std::vector<geometry_msgs::PoseStamped> current_poses_;
     std::vector<geometry_msgs::TwistStamped> current_velocities_;
+    std::vector<dbot_ros_msgs::ObjectState> current_state_messages_;
     sensor_msgs::Image current_ros_image_;
     std::mutex obsrv_mutex_;
     std::shared_ptr<Tracker> tracker_;
     std::shared_ptr<dbot::CameraData> camera_data_;
+    std::shared_ptr<SessionRecorder> session_recorder_;
+    std::shared_ptr<FlightRecorder> flight_recorder_;
 };
 }
@@ -34,7 +34,8 @@ ObjectTrackerRos<Tracker>::ObjectTrackerRos(
       camera_data_(camera_data),
       object_count_(object_count),
       obsrv_updated_(false),
-      running_(false)
+      running_(false),
+      step_duration_(ri::default_frame_period)
 {
 }
 
@@ -44,26 +45,66 @@ void ObjectTrackerRos<Tracker>::track(const sensor_msgs::Image& ros_image)
     auto image = ri::to_eigen_vector<typename Obsrv::Scalar>(
         ros_image, camera_data_->downsampling_factor());
 
-    current_poses_.clear();
-    current_velocities_.clear();
     current_state_ = tracker_->track(image);
-    geometry_msgs::PoseStamped current_pose;
-    geometry_msgs::TwistStamped current_velocity;
+
+    // each tracked image is one filter step of the transition model
+    step_duration_ = ri::step_duration(last_stamp_, ros_image.header.stamp);
+    last_stamp_    = ros_image.header.stamp;
+
+    // the messages are updated in place such that their frame_id strings
+    // keep their capacity and no allocation happens after the first frame
+    current_poses_.resize(object_count_);
+    current_velocities_.resize(object_count_);
+    current_state_messages_.resize(object_count_);
     for (int i = 0; i < object_count_; ++i)
     {
+        auto& current_pose = current_poses_[i];
         current_pose.pose = ri::to_ros_pose(current_state_.component(i));
         current_pose.header.stamp    = ros_image.header.stamp;
         current_pose.header.frame_id = ros_image.header.frame_id;
-        current_poses_.push_back(current_pose);
 
+        auto& current_velocity = current_velocities_[i];
         current_velocity.twist =
             ri::to_ros_velocity(current_state_.component(i));
         current_velocity.header.stamp    = ros_image.header.stamp;
         current_velocity.header.frame_id = ros_image.header.frame_id;
-        current_velocities_.push_back(current_velocity);
+
+        current_state_messages_[i].pose     = current_pose;
+        current_state_messages_[i].velocity = current_velocity;
+    }
+
+    if (session_recorder_)
+    {
+        session_recorder_->record(ros_image, current_state_messages());
+    }
+
+    if (flight_recorder_)
+    {
+        flight_recorder_->record(
+            ros_image,
+            current_state_messages(),
+            (ros::Time::now() - ros_image.header.stamp).toSec());
     }
 }
 
+template <typename Tracker>
+void ObjectTrackerRos<Tracker>::initialize(
+    const std::vector<State>& initial_states)
+{
+    tracker_->initialize(initial_states);
+    current_state_ = initial_states[0];
+    last_stamp_    = ros::Time();
+    step_duration_ = ri::default_frame_period;
+}
+
+template <typename Tracker>
+void ObjectTrackerRos<Tracker>::reinitialize(
+    const std::shared_ptr<Tracker>& tracker)
+{
+    tracker->initialize({current_state_});
+    tracker_ = tracker;
+}
+
 
 template <typename Tracker>
 void ObjectTrackerRos<Tracker>::update_obsrv(
@@ -90,6 +131,20 @@ void ObjectTrackerRos<Tracker>::shutdown()
     running_ = false;
 }
 
+template <typename Tracker>
+void ObjectTrackerRos<Tracker>::session_recorder(
+    const std::shared_ptr<SessionRecorder>& recorder)
+{
+    session_recorder_ = recorder;
+}
+
+template <typename Tracker>
+void ObjectTrackerRos<Tracker>::flight_recorder(
+    const std::shared_ptr<FlightRecorder>& recorder)
+{
+    flight_recorder_ = recorder;
+}
+
 template <typename Tracker>
 void ObjectTrackerRos<Tracker>::run()
 {
@@ -137,22 +192,17 @@ auto ObjectTrackerRos<Tracker>::current_pose() const
     return current_poses_[0];
 }
 
-
 template <typename Tracker>
 auto ObjectTrackerRos<Tracker>::current_state_messages() const
-    -> std::vector<dbot_ros_msgs::ObjectState>
+    -> const std::vector<dbot_ros_msgs::ObjectState>&
 {
-    std::vector<dbot_ros_msgs::ObjectState> state_messages;
-
-    for (int i = 0; i < current_poses_.size(); ++i)
-    {
-        dbot_ros_msgs::ObjectState object_state_message;
-        object_state_message.pose     = current_poses_[i];
-        object_state_message.velocity = current_velocities_[i];
-        state_messages.push_back(object_state_message);
-    }
+    return current_state_messages_;
+}
 
-    return state_messages;
+template <typename Tracker>
+double ObjectTrackerRos<Tracker>::current_step_duration() const
+{
+    return step_duration_;
 }
 
 template <typename Tracker>
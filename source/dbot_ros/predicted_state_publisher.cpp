@@ -0,0 +1,118 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file predicted_state_publisher.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <dbot_ros/predicted_state_publisher.h>
+#include <dbot_ros/util/ros_interface.h>
+
+namespace dbot
+{
+PredictedStatePublisher::PredictedStatePublisher(
+    const ObjectResourceIdentifier& ori,
+    const Parameters& params)
+    : node_handle_("~"), params_(params), stop_(false)
+{
+    publisher_ = node_handle_.advertise<dbot_ros::ObjectStateArray>(
+        "object_states_predicted", 1);
+
+    prediction_.predicted = true;
+    for (int i = 0; i < ori.count_meshes(); i++)
+    {
+        dbot_ros_msgs::ObjectState object_state;
+        object_state.name          = ori.mesh_without_extension(i);
+        object_state.ori.name      = ori.mesh(i);
+        object_state.ori.directory = ori.directory();
+        object_state.ori.package   = ori.package();
+        prediction_.states.push_back(object_state);
+    }
+
+    thread_ = std::thread(&PredictedStatePublisher::run, this);
+}
+
+PredictedStatePublisher::~PredictedStatePublisher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    stop_condition_.notify_all();
+    thread_.join();
+}
+
+void PredictedStatePublisher::update(
+    const std::vector<dbot_ros_msgs::ObjectState>& states,
+    double step_duration)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_ = states;
+    for (auto& state : states_)
+    {
+        state.velocity.twist =
+            ri::to_ros_velocity(state.velocity.twist, step_duration);
+    }
+}
+
+void PredictedStatePublisher::run()
+{
+    typedef std::chrono::steady_clock Clock;
+
+    auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / params_.rate));
+    auto next = Clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        // do not catch up on missed periods
+        next = std::max(next + period, Clock::now());
+        if (stop_condition_.wait_until(lock, next, [this]() { return stop_; }))
+        {
+            break;
+        }
+
+        if (states_.size() != prediction_.states.size()) continue;
+
+        ros::Time now = ros::Time::now();
+        double dt     = (now - states_[0].pose.header.stamp).toSec();
+        if (dt > params_.max_extrapolation)
+        {
+            ROS_WARN_THROTTLE(5.0,
+                              "Latest estimate is %f s old, predictions "
+                              "paused",
+                              dt);
+            continue;
+        }
+        dt = std::max(dt, 0.0);
+
+        prediction_.header        = states_[0].pose.header;
+        prediction_.header.stamp  = now;
+        prediction_.extrapolation = ros::Duration(dt);
+        for (size_t i = 0; i < states_.size(); ++i)
+        {
+            auto& predicted           = prediction_.states[i];
+            predicted.pose.header     = prediction_.header;
+            predicted.pose.pose       = ri::extrapolate(
+                states_[i].pose.pose, states_[i].velocity.twist, dt);
+            predicted.velocity        = states_[i].velocity;
+            predicted.velocity.header = prediction_.header;
+        }
+
+        publisher_.publish(prediction_);
+    }
+}
+}
@@ -0,0 +1,82 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file predicted_state_publisher.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/ObjectStateArray.h>
+#include <dbot_ros/util/runtime_parameters.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <mutex>
+#include <ros/ros.h>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Publishes the latest object state estimates extrapolated to the
+ * current time at a fixed rate, e.g. for control loops running faster than
+ * the camera.
+ *
+ * The predictions are published from a dedicated thread as ObjectStateArray
+ * on object_states_predicted with the predicted flag set. Their stamp is the
+ * time predicted for, and the extrapolation is the time since the image the
+ * estimates are based on. Unlike on object_state, the predicted velocities
+ * are given in [m/s] and [rad/s].
+ */
+class PredictedStatePublisher
+{
+public:
+    typedef PredictedStatePublisherParameters Parameters;
+
+public:
+    PredictedStatePublisher(const ObjectResourceIdentifier& ori,
+                            const Parameters& params = Parameters());
+
+    /**
+     * \brief Stops the publishing thread
+     */
+    ~PredictedStatePublisher();
+
+    /**
+     * \brief Sets the estimates the predictions are extrapolated from
+     *
+     * \param states		estimates with per filter step velocities
+     * \param step_duration	duration [s] of the filter step
+     */
+    void update(const std::vector<dbot_ros_msgs::ObjectState>& states,
+                double step_duration);
+
+private:
+    void run();
+
+private:
+    ros::NodeHandle node_handle_;
+    ros::Publisher publisher_;
+    Parameters params_;
+
+    std::mutex mutex_;
+    std::condition_variable stop_condition_;
+    bool stop_;
+    std::vector<dbot_ros_msgs::ObjectState> states_;
+    dbot_ros::ObjectStateArray prediction_;
+
+    std::thread thread_;
+};
+}
@@ -0,0 +1,407 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file synthetic_camera_node.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Stand-in for a depth camera driver. Publishes depth images and camera info
+ * on the topics configured in camera.yaml at a configurable rate, jitter,
+ * resolution and encoding. The frames are rendered from a synthetic scenario
+ * or taken from a TrackingDataset.
+ *
+ * Each image is stamped at publishing time. The node measures the
+ * end-to-end latency of the live tracking path by subscribing to the object
+ * states. The batched object_states carry the stamp of the tracked image
+ * minus the extrapolation of the latency compensation, and are used if they
+ * are published. Otherwise the per-object object_state messages are used,
+ * which carry the image stamp only while latency compensation is disabled.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <dbot_ros/ObjectStateArray.h>
+#include <dbot_ros/util/synthetic_scene.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <ros/package.h>
+#include <ros/ros.h>
+#include <sensor_msgs/CameraInfo.h>
+#include <sensor_msgs/Image.h>
+#include <string>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+/**
+ * \brief Converts a 32FC1 depth image in meters into the requested encoding
+ */
+static void encode(const sensor_msgs::Image& image,
+                   const std::string& encoding,
+                   sensor_msgs::Image& encoded)
+{
+    if (encoding != "16UC1" || image.encoding != "32FC1")
+    {
+        encoded = image;
+        return;
+    }
+
+    encoded.header       = image.header;
+    encoded.width        = image.width;
+    encoded.height       = image.height;
+    encoded.encoding     = encoding;
+    encoded.is_bigendian = 0;
+    encoded.step         = image.width * sizeof(uint16_t);
+    encoded.data.resize(encoded.step * encoded.height);
+
+    const float* depth = reinterpret_cast<const float*>(image.data.data());
+    uint16_t* millimeters = reinterpret_cast<uint16_t*>(encoded.data.data());
+    for (size_t i = 0; i < size_t(image.width) * image.height; ++i)
+    {
+        // zero marks missing measurements in 16UC1 depth images
+        float value    = std::round(depth[i] * 1000.0f);
+        millimeters[i] = std::isfinite(value) && value > 0.0f &&
+                                 value <= std::numeric_limits<uint16_t>::max()
+                             ? uint16_t(value)
+                             : 0;
+    }
+}
+
+/**
+ * \brief Sets the scenario camera to the given resolution and scales the
+ * intrinsics accordingly
+ */
+static void set_resolution(YAML::Node camera, int width, int height)
+{
+    double width_scale  = width / camera["width"].as<double>(640);
+    double height_scale = height / camera["height"].as<double>(480);
+
+    camera["fx"] = camera["fx"].as<double>(525.0) * width_scale;
+    camera["cx"] = camera["cx"].as<double>(319.5) * width_scale;
+    camera["fy"] = camera["fy"].as<double>(525.0) * height_scale;
+    camera["cy"] = camera["cy"].as<double>(239.5) * height_scale;
+    camera["width"]  = width;
+    camera["height"] = height;
+}
+
+/**
+ * \brief Collects the latencies of the received object states
+ */
+class LatencyMonitor
+{
+public:
+    void object_states_callback(const dbot_ros::ObjectStateArray& states)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // the compensated states are stamped ahead of the image by the
+        // extrapolation
+        batched_ = true;
+        record(states.header.stamp - states.extrapolation);
+    }
+
+    void object_state_callback(const dbot_ros_msgs::ObjectState& state)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (batched_) return;
+        record(state.pose.header.stamp);
+    }
+
+    void frame_published()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++published_frames_;
+    }
+
+    void report(const ros::WallTimerEvent&)
+    {
+        std::vector<double> latencies;
+        size_t published_frames;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            latencies.swap(latencies_);
+            published_frames  = published_frames_;
+            published_frames_ = 0;
+        }
+
+        if (latencies.empty())
+        {
+            ROS_INFO("published %zu frames, no object states received",
+                     published_frames);
+            return;
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](double p)
+        {
+            return 1000.0 * latencies[size_t(p * (latencies.size() - 1))];
+        };
+
+        ROS_INFO(
+            "published %zu frames, tracked %zu, latency [ms] p50 %.1f "
+            "p90 %.1f p99 %.1f max %.1f",
+            published_frames,
+            latencies.size(),
+            percentile(0.5),
+            percentile(0.9),
+            percentile(0.99),
+            1000.0 * latencies.back());
+    }
+
+private:
+    void record(const ros::Time& image_stamp)
+    {
+        // one message per object and frame, count each frame once
+        if (image_stamp == last_stamp_) return;
+        last_stamp_ = image_stamp;
+
+        latencies_.push_back((ros::Time::now() - image_stamp).toSec());
+    }
+
+private:
+    std::mutex mutex_;
+    bool batched_ = false;
+    ros::Time last_stamp_;
+    std::vector<double> latencies_;
+    size_t published_frames_ = 0;
+};
+
+int main(int argc, char** argv)
+{
+    ros::init(argc, argv, "synthetic_camera");
+    ros::NodeHandle nh("~");
+
+    /* ------------------------------ */
+    /* - Parameters                 - */
+    /* ------------------------------ */
+    std::string depth_image_topic;
+    std::string camera_info_topic;
+    int width;
+    int height;
+    nh.param<std::string>(
+        "depth_image_topic", depth_image_topic, "/XTION/depth/image");
+    nh.param<std::string>(
+        "camera_info_topic", camera_info_topic, "/XTION/depth/camera_info");
+    nh.param("resolution/width", width, 640);
+    nh.param("resolution/height", height, 480);
+
+    std::string source;
+    std::string encoding;
+    std::string object_state_topic;
+    std::string object_states_topic;
+    double rate;
+    double jitter;
+    double report_interval;
+    bool loop;
+    nh.param<std::string>("synthetic_camera/source", source, "scenario");
+    nh.param<std::string>("synthetic_camera/encoding", encoding, "32FC1");
+    nh.param<std::string>("synthetic_camera/object_state_topic",
+                          object_state_topic,
+                          "/particle_tracker/object_state");
+    nh.param<std::string>("synthetic_camera/object_states_topic",
+                          object_states_topic,
+                          "/particle_tracker/object_states");
+    nh.param("synthetic_camera/rate", rate, 30.0);
+    nh.param("synthetic_camera/jitter", jitter, 0.0);
+    nh.param("synthetic_camera/report_interval", report_interval, 5.0);
+    nh.param("synthetic_camera/loop", loop, true);
+
+    if (encoding != "32FC1" && encoding != "16UC1")
+    {
+        ROS_ERROR("Unsupported encoding %s, use 32FC1 or 16UC1",
+                  encoding.c_str());
+        return 1;
+    }
+
+    if (rate <= 0.0)
+    {
+        ROS_ERROR("synthetic_camera/rate must be positive");
+        return 1;
+    }
+
+    /* ------------------------------ */
+    /* - Frame source               - */
+    /* ------------------------------ */
+    // both sources render or load a 32FC1 frame by index
+    std::function<void(size_t, sensor_msgs::Image&, sensor_msgs::CameraInfo&)>
+        get_frame;
+    size_t frame_count = 0;
+
+    if (source == "scenario")
+    {
+        std::string scenario_file;
+        std::string object_package;
+        std::string object_directory;
+        std::vector<std::string> object_meshes;
+        nh.getParam("synthetic_camera/scenario", scenario_file);
+        nh.getParam("object/package", object_package);
+        nh.getParam("object/directory", object_directory);
+        nh.getParam("object/meshes", object_meshes);
+
+        YAML::Node scenario;
+        try
+        {
+            scenario = YAML::LoadFile(scenario_file);
+        }
+        catch (YAML::Exception& e)
+        {
+            ROS_ERROR("Cannot load scenario %s: %s",
+                      scenario_file.c_str(),
+                      e.what());
+            return 1;
+        }
+        set_resolution(scenario["camera"], width, height);
+
+        dbot::ObjectResourceIdentifier ori;
+        ori.package_path(ros::package::getPath(object_package));
+        ori.directory(object_directory);
+        ori.meshes(object_meshes);
+
+        auto scene = std::make_shared<dbot::SyntheticScene>(ori);
+        if (!scene->load(scenario, scenario["seed"].as<unsigned int>(1)))
+        {
+            return 1;
+        }
+
+        frame_count = scenario["frames"].as<int>(300);
+        double scenario_rate = scenario["rate"].as<double>(30.0);
+        get_frame = [scene, scenario_rate](size_t index,
+                                           sensor_msgs::Image& image,
+                                           sensor_msgs::CameraInfo& info)
+        {
+            scene->render(index / scenario_rate, image);
+            info = scene->camera_info();
+        };
+    }
+    else if (source == "dataset")
+    {
+        std::string data_set_dir;
+        nh.getParam("synthetic_camera/dataset", data_set_dir);
+
+        auto data_set = std::make_shared<TrackingDataset>(data_set_dir);
+        frame_count = data_set->Size();
+        if (frame_count == 0)
+        {
+            ROS_ERROR("Dataset %s is empty", data_set_dir.c_str());
+            return 1;
+        }
+
+        if (int(data_set->GetImage(0)->width) != width ||
+            int(data_set->GetImage(0)->height) != height)
+        {
+            ROS_WARN("Publishing dataset frames at their recorded resolution");
+        }
+
+        get_frame = [data_set](size_t index,
+                               sensor_msgs::Image& image,
+                               sensor_msgs::CameraInfo& info)
+        {
+            image = *data_set->GetImage(index);
+            info  = *data_set->GetInfo(index);
+        };
+    }
+    else
+    {
+        ROS_ERROR("Unknown synthetic_camera/source %s, use scenario or "
+                  "dataset",
+                  source.c_str());
+        return 1;
+    }
+
+    /* ------------------------------ */
+    /* - Latency monitor            - */
+    /* ------------------------------ */
+    LatencyMonitor monitor;
+    ros::NodeHandle global_nh;
+    ros::Subscriber object_state_subscriber =
+        global_nh.subscribe(object_state_topic,
+                            100,
+                            &LatencyMonitor::object_state_callback,
+                            &monitor);
+    ros::Subscriber object_states_subscriber =
+        global_nh.subscribe(object_states_topic,
+                            10,
+                            &LatencyMonitor::object_states_callback,
+                            &monitor);
+    ros::WallTimer report_timer =
+        nh.createWallTimer(ros::WallDuration(report_interval),
+                           &LatencyMonitor::report,
+                           &monitor);
+
+    // callbacks are served while the main thread publishes
+    ros::AsyncSpinner spinner(1);
+    spinner.start();
+
+    /* ------------------------------ */
+    /* - Publish                    - */
+    /* ------------------------------ */
+    ros::Publisher image_publisher =
+        global_nh.advertise<sensor_msgs::Image>(depth_image_topic, 1);
+    ros::Publisher camera_info_publisher =
+        global_nh.advertise<sensor_msgs::CameraInfo>(camera_info_topic, 1);
+
+    ROS_INFO("Publishing %s frames at %.1f Hz on %s",
+             encoding.c_str(),
+             rate,
+             depth_image_topic.c_str());
+
+    std::mt19937 random(0);
+    std::uniform_real_distribution<double> jitter_distribution(-jitter,
+                                                               jitter);
+
+    ros::WallTime start = ros::WallTime::now();
+    for (size_t i = 0; ros::ok(); ++i)
+    {
+        if (i >= frame_count && !loop) break;
+
+        // the frame is prepared ahead of its release time
+        sensor_msgs::Image image;
+        sensor_msgs::CameraInfoPtr info(new sensor_msgs::CameraInfo());
+        sensor_msgs::ImagePtr encoded(new sensor_msgs::Image());
+        get_frame(i % frame_count, image, *info);
+        encode(image, encoding, *encoded);
+
+        double offset = i / rate;
+        if (jitter > 0.0) offset += jitter_distribution(random);
+        ros::WallTime release =
+            start + ros::WallDuration(std::max(0.0, offset));
+        if (ros::WallTime::now() < release)
+        {
+            (release - ros::WallTime::now()).sleep();
+        }
+        else if ((ros::WallTime::now() - release).toSec() > 1.0 / rate)
+        {
+            ROS_WARN_THROTTLE(5.0, "Frame preparation falls behind the rate");
+        }
+
+        encoded->header.stamp = ros::Time::now();
+        encoded->header.seq   = i;
+        info->header.stamp    = encoded->header.stamp;
+        info->header.frame_id = encoded->header.frame_id;
+        info->width           = encoded->width;
+        info->height          = encoded->height;
+
+        camera_info_publisher.publish(info);
+        image_publisher.publish(encoded);
+        monitor.frame_published();
+    }
+
+    spinner.stop();
+
+    return 0;
+}
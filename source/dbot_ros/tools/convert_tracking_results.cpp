@@ -0,0 +1,155 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file convert_tracking_results.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Converts tracking results and ground truth between the text format written
+ * by TrackingDataset (one row per frame, time stamp followed by the values)
+ * and the binary tracking result format.
+ *
+ * Usage:
+ *   convert_tracking_results to_binary <in.txt> <out.bin>
+ *                            <object_count> <pose_size>
+ *                            [velocity_size] [stats_size]
+ *   convert_tracking_results to_text <in.bin> <out.txt>
+ */
+
+#include <cstdlib>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  convert_tracking_results to_binary <in.txt> <out.bin> "
+                 "<object_count> <pose_size> [velocity_size] [stats_size]\n"
+              << "  convert_tracking_results to_text <in.bin> <out.txt>"
+              << std::endl;
+    return 1;
+}
+
+static int to_binary(const std::string& in,
+                     const std::string& out,
+                     const dbot::TrackingResultLayout& layout)
+{
+    std::ifstream file(in.c_str());
+    if (!file.is_open())
+    {
+        std::cerr << "could not open file " << in << std::endl;
+        return 1;
+    }
+
+    dbot::TrackingResultWriter writer(out, layout);
+    if (!writer.is_open()) return 1;
+
+    std::vector<double> values;
+    dbot::TrackingResultRecord record;
+    std::string row;
+    size_t row_number = 0;
+    while (std::getline(file, row))
+    {
+        ++row_number;
+        values.clear();
+        const char* begin = row.c_str();
+        char* end         = nullptr;
+        while (true)
+        {
+            double value = std::strtod(begin, &end);
+            if (end == begin) break;
+            values.push_back(value);
+            begin = end;
+        }
+
+        if (values.empty()) continue;
+
+        if (values.size() != 1 + layout.value_count())
+        {
+            std::cerr << "row " << row_number << " has " << values.size() - 1
+                      << " values, expected " << layout.value_count()
+                      << std::endl;
+            return 1;
+        }
+
+        record.stamp = values[0];
+        record.values =
+            Eigen::Map<Eigen::VectorXd>(values.data() + 1, values.size() - 1);
+        if (!writer.write(record))
+        {
+            std::cerr << "could not write file " << out << std::endl;
+            return 1;
+        }
+    }
+
+    if (!writer.close())
+    {
+        std::cerr << "could not write file " << out << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+static int to_text(const std::string& in, const std::string& out)
+{
+    dbot::TrackingResultReader reader(in);
+    std::vector<dbot::TrackingResultRecord> records;
+    if (!reader.is_open() || !reader.read_all(records)) return 1;
+
+    std::ofstream file(out.c_str(), std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "could not open file " << out << std::endl;
+        return 1;
+    }
+
+    // print all digits so that the conversion is lossless
+    file << std::setprecision(17);
+    for (auto& record : records)
+    {
+        file << record.stamp;
+        for (int i = 0; i < record.values.size(); ++i)
+        {
+            file << " " << record.values(i);
+        }
+        file << "\n";
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) return usage();
+
+    std::string mode = argv[1];
+
+    if (mode == "to_text" && argc == 4)
+    {
+        return to_text(argv[2], argv[3]);
+    }
+
+    if (mode == "to_binary" && argc >= 6 && argc <= 8)
+    {
+        dbot::TrackingResultLayout layout(std::atoi(argv[4]),
+                                          std::atoi(argv[5]),
+                                          argc > 6 ? std::atoi(argv[6]) : 0,
+                                          argc > 7 ? std::atoi(argv[7]) : 0);
+        return to_binary(argv[2], argv[3], layout);
+    }
+
+    return usage();
+}
@@ -0,0 +1,562 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file evaluate_parameter_grid.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Evaluates a tracker on a set of datasets for every configuration of a
+ * parameter grid. Each (configuration, dataset) pair is an independent job.
+ * The jobs are distributed over a pool of worker threads, each running its
+ * own tracker instance, and replayed headless as fast as possible. The
+ * trackers are initialized with the ground truth of the first frame.
+ *
+ * For every configuration, the throughput, the percentiles of the
+ * Tracker::track() latency and the mean translation and rotation errors with
+ * respect to the ground truth are reported. Configurations which are not
+ * dominated by any other in throughput and accuracy are marked as Pareto
+ * optimal.
+ *
+ * Usage:
+ *   evaluate_parameter_grid <grid.yaml> [results.csv]
+ *
+ * Grid file:
+ *   tracker: particle            # or gaussian
+ *   threads: 0                   # 0 uses all cores
+ *   config:                      # base configuration, see replay_dataset
+ *     - config/object.yaml
+ *     - config/camera.yaml
+ *     - config/particle_tracker.yaml
+ *   datasets:
+ *     - /data/duck_01
+ *     - /data/duck_02
+ *   grid:                        # parameter path: list of values
+ *     downsampling_factor: [4, 8]
+ *     particle_filter/cpu/sample_count: [100, 200, 400]
+ *     particle_filter/max_kl_divergence: [1.0, 2.0]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <dbot/camera_data.h>
+#include <dbot/pose/pose_vector.h>
+#include <dbot_ros/util/data_set_camera_data_provider.h>
+#include <dbot_ros/util/replay_driver.h>
+#include <dbot_ros/util/tracker_factory.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros/util/yaml_config.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ros/time.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Parameter values of one grid point
+ */
+typedef std::vector<std::pair<std::string, YAML::Node>> Configuration;
+
+struct Job
+{
+    size_t configuration;
+    size_t data_set;
+};
+
+struct JobResult
+{
+    JobResult() : failed(false) {}
+
+    bool failed;
+    std::vector<double> track_durations;
+    std::vector<double> translation_errors;
+    std::vector<double> rotation_errors;
+};
+
+struct Summary
+{
+    size_t frames;
+    size_t failed;
+    double frames_per_second;
+    double latency_p50;
+    double latency_p90;
+    double latency_p99;
+    double translation_error;
+    double rotation_error;
+    bool pareto_optimal;
+};
+
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  evaluate_parameter_grid <grid.yaml> [results.csv]"
+              << std::endl;
+    return 1;
+}
+
+/**
+ * \brief Expands the grid into the cartesian product of its values
+ */
+static std::vector<Configuration> expand_grid(const YAML::Node& grid)
+{
+    std::vector<Configuration> configurations(1);
+
+    for (auto it = grid.begin(); it != grid.end(); ++it)
+    {
+        auto path   = it->first.as<std::string>();
+        auto values = it->second;
+        if (!values.IsSequence())
+        {
+            for (auto& configuration : configurations)
+            {
+                configuration.push_back(std::make_pair(path, values));
+            }
+            continue;
+        }
+
+        std::vector<Configuration> expanded;
+        for (auto& configuration : configurations)
+        {
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                expanded.push_back(configuration);
+                expanded.back().push_back(std::make_pair(path, values[i]));
+            }
+        }
+        configurations.swap(expanded);
+    }
+
+    return configurations;
+}
+
+/**
+ * \brief Returns the base configuration overridden by the grid point
+ */
+static dbot::YamlConfig apply(const dbot::YamlConfig& base_config,
+                              const Configuration& configuration)
+{
+    dbot::YamlConfig config = base_config;
+    for (auto& value : configuration)
+    {
+        config.set(value.first, value.second);
+    }
+
+    return config;
+}
+
+/**
+ * \brief Nearest rank percentile of sorted values
+ */
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+
+    size_t rank = std::ceil(p / 100.0 * sorted.size());
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+template <typename Tracker>
+static JobResult evaluate(
+    const std::function<std::shared_ptr<Tracker>(
+        const dbot::OfflineTrackerConfig&,
+        const std::shared_ptr<dbot::CameraData>&)>& create_tracker,
+    const dbot::OfflineTrackerConfig& config,
+    const std::shared_ptr<TrackingDataset>& data_set,
+    std::mutex& construction_mutex)
+{
+    typedef typename dbot::ReplayDriver<Tracker>::State State;
+
+    JobResult result;
+    int object_count = config.object.meshes.size();
+
+    std::shared_ptr<Tracker> tracker;
+    std::shared_ptr<dbot::DataSetCameraDataProvider> camera_provider;
+    {
+        // model loading is not thread safe
+        std::lock_guard<std::mutex> lock(construction_mutex);
+
+        camera_provider = std::make_shared<dbot::DataSetCameraDataProvider>(
+            data_set, config.camera.downsampling_factor);
+        tracker = create_tracker(
+            config, std::make_shared<dbot::CameraData>(camera_provider));
+    }
+
+    dbot::ReplayDriver<Tracker> driver(
+        tracker, data_set, camera_provider, object_count);
+
+    if (!driver.initialize_from_ground_truth())
+    {
+        result.failed = true;
+        return result;
+    }
+
+    driver.run(
+        [&](size_t frame, const sensor_msgs::Image&, const State& state)
+        {
+            Eigen::VectorXd ground_truth = data_set->GetGroundTruth(frame);
+            if (ground_truth.size() == 0 ||
+                ground_truth.size() % object_count != 0)
+            {
+                return;
+            }
+
+            int dimension = ground_truth.size() / object_count;
+            if (dimension < dbot::PoseVector::SizeAtCompileTime) return;
+
+            for (int i = 0; i < object_count; ++i)
+            {
+                dbot::PoseVector true_pose = ground_truth.segment(
+                    i * dimension, dbot::PoseVector::SizeAtCompileTime);
+                auto estimate = state.component(i);
+
+                result.translation_errors.push_back(
+                    (estimate.position() - true_pose.position()).norm());
+                result.rotation_errors.push_back(
+                    estimate.orientation().quaternion().angularDistance(
+                        true_pose.orientation().quaternion()));
+            }
+        });
+
+    result.track_durations = driver.track_durations();
+
+    return result;
+}
+
+static std::vector<Summary> summarize(
+    const std::vector<Configuration>& configurations,
+    const std::vector<Job>& jobs,
+    const std::vector<JobResult>& results)
+{
+    std::vector<Summary> summaries(configurations.size());
+
+    for (size_t c = 0; c < configurations.size(); ++c)
+    {
+        std::vector<double> durations;
+        double translation_error = 0.0;
+        double rotation_error    = 0.0;
+        size_t error_count       = 0;
+        size_t failed            = 0;
+
+        for (size_t j = 0; j < jobs.size(); ++j)
+        {
+            if (jobs[j].configuration != c) continue;
+            if (results[j].failed)
+            {
+                ++failed;
+                continue;
+            }
+
+            auto& result = results[j];
+            durations.insert(durations.end(),
+                             result.track_durations.begin(),
+                             result.track_durations.end());
+            for (size_t k = 0; k < result.translation_errors.size(); ++k)
+            {
+                translation_error += result.translation_errors[k];
+                rotation_error += result.rotation_errors[k];
+                ++error_count;
+            }
+        }
+
+        double total_duration = 0.0;
+        for (auto duration : durations) total_duration += duration;
+        std::sort(durations.begin(), durations.end());
+
+        Summary& summary          = summaries[c];
+        summary.frames            = durations.size();
+        summary.failed            = failed;
+        summary.frames_per_second =
+            total_duration > 0.0 ? durations.size() / total_duration : 0.0;
+        summary.latency_p50 = percentile(durations, 50.0);
+        summary.latency_p90 = percentile(durations, 90.0);
+        summary.latency_p99 = percentile(durations, 99.0);
+        summary.translation_error =
+            error_count > 0 ? translation_error / error_count : NAN;
+        summary.rotation_error =
+            error_count > 0 ? rotation_error / error_count : NAN;
+    }
+
+    // Pareto front over throughput, translation and rotation error
+    for (auto& a : summaries)
+    {
+        a.pareto_optimal = a.failed == 0 && a.frames > 0 &&
+                           std::isfinite(a.translation_error);
+        for (auto& b : summaries)
+        {
+            if (!a.pareto_optimal) break;
+            if (&a == &b || b.failed > 0 || b.frames == 0) continue;
+
+            bool not_worse = b.frames_per_second >= a.frames_per_second &&
+                             b.translation_error <= a.translation_error &&
+                             b.rotation_error <= a.rotation_error;
+            bool better = b.frames_per_second > a.frames_per_second ||
+                          b.translation_error < a.translation_error ||
+                          b.rotation_error < a.rotation_error;
+            if (not_worse && better) a.pareto_optimal = false;
+        }
+    }
+
+    return summaries;
+}
+
+static void print_table(std::ostream& out,
+                        const std::vector<Configuration>& configurations,
+                        const std::vector<Summary>& summaries,
+                        const std::string& separator,
+                        int width)
+{
+    auto column = [&](std::ostream& stream) -> std::ostream&
+    {
+        if (width > 0) stream << std::setw(width);
+        return stream;
+    };
+
+    column(out) << "config";
+    if (!configurations.empty())
+    {
+        for (auto& value : configurations[0])
+        {
+            out << separator;
+            column(out) << value.first;
+        }
+    }
+    for (auto name : {"frames",
+                      "fps",
+                      "p50_ms",
+                      "p90_ms",
+                      "p99_ms",
+                      "trans_err_mm",
+                      "rot_err_deg",
+                      "failed",
+                      "pareto"})
+    {
+        out << separator;
+        column(out) << name;
+    }
+    out << "\n";
+
+    for (size_t c = 0; c < configurations.size(); ++c)
+    {
+        auto& summary = summaries[c];
+
+        column(out) << c;
+        for (auto& value : configurations[c])
+        {
+            out << separator;
+            column(out) << value.second.as<std::string>();
+        }
+        out << std::fixed << std::setprecision(3);
+        out << separator;
+        column(out) << summary.frames;
+        out << separator;
+        column(out) << summary.frames_per_second;
+        out << separator;
+        column(out) << summary.latency_p50 * 1e3;
+        out << separator;
+        column(out) << summary.latency_p90 * 1e3;
+        out << separator;
+        column(out) << summary.latency_p99 * 1e3;
+        out << separator;
+        column(out) << summary.translation_error * 1e3;
+        out << separator;
+        column(out) << summary.rotation_error * 180.0 / M_PI;
+        out << separator;
+        column(out) << summary.failed;
+        out << separator;
+        column(out) << (summary.pareto_optimal ? "*" : "");
+        out << "\n";
+        out.unsetf(std::ios::floatfield);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) return usage();
+
+    YAML::Node grid_file;
+    try
+    {
+        grid_file = YAML::LoadFile(argv[1]);
+    }
+    catch (YAML::Exception& e)
+    {
+        std::cerr << "could not load " << argv[1] << ": " << e.what()
+                  << std::endl;
+        return 1;
+    }
+
+    auto tracker_type = grid_file["tracker"].as<std::string>("particle");
+    auto threads      = grid_file["threads"].as<int>(0);
+    auto config_files =
+        grid_file["config"].as<std::vector<std::string>>(
+            std::vector<std::string>());
+    auto data_set_dirs =
+        grid_file["datasets"].as<std::vector<std::string>>(
+            std::vector<std::string>());
+
+    dbot::YamlConfig base_config;
+    for (auto& config_file : config_files)
+    {
+        if (!base_config.load(config_file)) return 1;
+    }
+
+    auto configurations = expand_grid(grid_file["grid"]);
+
+    if (tracker_type != "particle" && tracker_type != "gaussian")
+    {
+        std::cerr << "unknown tracker " << tracker_type << std::endl;
+        return 1;
+    }
+
+    // every configuration is read and validated as by the tracker nodes
+    // before any job starts
+    std::vector<dbot::OfflineTrackerConfig> tracker_configs(
+        configurations.size());
+    for (size_t c = 0; c < configurations.size(); ++c)
+    {
+        if (!dbot::read(apply(base_config, configurations[c]),
+                        tracker_type,
+                        tracker_configs[c]))
+        {
+            std::cerr << "configuration " << c << " is invalid" << std::endl;
+            return 1;
+        }
+    }
+
+    // rosbag and message time stamps require the time source without a node
+    ros::Time::init();
+
+    /* ------------------------------ */
+    /* - Datasets                   - */
+    /* ------------------------------ */
+    // datasets are loaded once and only read concurrently by the workers
+    std::vector<std::shared_ptr<TrackingDataset>> data_sets;
+    for (auto& data_set_dir : data_set_dirs)
+    {
+        data_sets.push_back(std::make_shared<TrackingDataset>(data_set_dir));
+        if (data_sets.back()->Size() == 0)
+        {
+            std::cerr << "dataset " << data_set_dir << " is empty"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    /* ------------------------------ */
+    /* - Jobs                       - */
+    /* ------------------------------ */
+    std::vector<Job> jobs;
+    for (size_t c = 0; c < configurations.size(); ++c)
+    {
+        for (size_t d = 0; d < data_sets.size(); ++d)
+        {
+            jobs.push_back({c, d});
+        }
+    }
+    std::vector<JobResult> results(jobs.size());
+
+    if (threads <= 0) threads = std::thread::hardware_concurrency();
+    bool use_gpu = false;
+    for (auto& tracker_config : tracker_configs)
+    {
+        auto& observation = tracker_config.particle_filter.observation;
+        if (tracker_type == "particle" && observation.use_gpu) use_gpu = true;
+    }
+    if (use_gpu && threads > 1)
+    {
+        std::cerr << "GPU particle trackers are evaluated sequentially"
+                  << std::endl;
+        threads = 1;
+    }
+    threads = std::max(1, std::min<int>(threads, jobs.size()));
+
+    std::cout << configurations.size() << " configurations, "
+              << data_sets.size() << " datasets, " << jobs.size()
+              << " jobs on " << threads << " threads" << std::endl;
+
+    std::atomic<size_t> next_job(0);
+    std::mutex construction_mutex;
+    std::mutex print_mutex;
+
+    auto worker = [&]()
+    {
+        for (size_t j = next_job++; j < jobs.size(); j = next_job++)
+        {
+            auto& config = tracker_configs[jobs[j].configuration];
+
+            auto& data_set = data_sets[jobs[j].data_set];
+            if (tracker_type == "gaussian")
+            {
+                results[j] = evaluate<dbot::GaussianTracker>(
+                    [&](const dbot::OfflineTrackerConfig& config,
+                        const std::shared_ptr<dbot::CameraData>& camera_data)
+                    {
+                        return dbot::create_gaussian_tracker(config,
+                                                             camera_data);
+                    },
+                    config,
+                    data_set,
+                    construction_mutex);
+            }
+            else
+            {
+                results[j] = evaluate<dbot::ParticleTracker>(
+                    [&](const dbot::OfflineTrackerConfig& config,
+                        const std::shared_ptr<dbot::CameraData>& camera_data)
+                    {
+                        return dbot::create_particle_tracker(config,
+                                                             camera_data);
+                    },
+                    config,
+                    data_set,
+                    construction_mutex);
+            }
+
+            std::lock_guard<std::mutex> lock(print_mutex);
+            std::cout << "[" << j + 1 << "/" << jobs.size() << "] config "
+                      << jobs[j].configuration << " on "
+                      << data_set_dirs[jobs[j].data_set]
+                      << (results[j].failed ? " failed" : " done")
+                      << std::endl;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i) workers.emplace_back(worker);
+    for (auto& thread : workers) thread.join();
+
+    /* ------------------------------ */
+    /* - Report                     - */
+    /* ------------------------------ */
+    auto summaries = summarize(configurations, jobs, results);
+
+    print_table(std::cout, configurations, summaries, " ", 14);
+
+    if (argc > 2)
+    {
+        std::ofstream csv(argv[2]);
+        if (!csv.is_open())
+        {
+            std::cerr << "could not open file " << argv[2] << std::endl;
+            return 1;
+        }
+        print_table(csv, configurations, summaries, ",", 0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file generate_synthetic_dataset.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Renders a scripted scenario into a TrackingDataset including per frame
+ * ground truth. Such datasets serve as reproducible benchmarks which do not
+ * require a camera, see replay_dataset and evaluate_parameter_grid.
+ *
+ * The object meshes are taken from the object configuration, i.e. the same
+ * YAML files which are loaded by the tracker launch files. The scenario
+ * format is documented in dbot_ros/util/synthetic_scene.h. Additionally it
+ * provides the number of frames, the frame rate and the noise seed
+ * \code
+ * frames: 300
+ * rate: 30
+ * seed: 1
+ * \endcode
+ *
+ * The ground truth is the pose of the mesh frame, i.e. trackers evaluated on
+ * the dataset must not center the object frame
+ * (particle_filter/center_object_frame or gaussian_filter/center_object_frame
+ * = false).
+ *
+ * Usage:
+ *   generate_synthetic_dataset <scenario.yaml> <output_dir> <config.yaml>...
+ *
+ * Example:
+ *   generate_synthetic_dataset config/synthetic_scenario.yaml /data/synthetic
+ *                              config/object.yaml
+ */
+
+#include <dbot/pose/pose_vector.h>
+#include <dbot_ros/util/synthetic_scene.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros/util/yaml_config.h>
+#include <iostream>
+#include <ros/time.h>
+#include <string>
+#include <yaml-cpp/yaml.h>
+
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  generate_synthetic_dataset <scenario.yaml> <output_dir> "
+                 "<config.yaml>..."
+              << std::endl;
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) return usage();
+
+    std::string scenario_file = argv[1];
+    std::string output_dir    = argv[2];
+
+    dbot::YamlConfig config;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (!config.load(argv[i])) return 1;
+    }
+
+    dbot::ParameterReader reader(config);
+    dbot::ObjectConfig object_config;
+    dbot::read(reader, "object/", object_config);
+    if (!reader.report()) return 1;
+
+    YAML::Node scenario;
+    try
+    {
+        scenario = YAML::LoadFile(scenario_file);
+    }
+    catch (YAML::Exception& e)
+    {
+        std::cerr << "cannot load " << scenario_file << ": " << e.what()
+                  << std::endl;
+        return 1;
+    }
+
+    // message time stamps require the time source without a node
+    ros::Time::init();
+
+    int frames        = scenario["frames"].as<int>(300);
+    double rate       = scenario["rate"].as<double>(30.0);
+    unsigned int seed = scenario["seed"].as<unsigned int>(1);
+    if (frames <= 0 || rate <= 0.0)
+    {
+        std::cerr << "frames and rate must be positive" << std::endl;
+        return 1;
+    }
+
+    dbot::SyntheticScene scene(object_config.ori());
+    if (!scene.load(scenario, seed)) return 1;
+
+    auto data_set = TrackingDataset::CreateEmpty(output_dir);
+    ros::Time start = ros::Time::now();
+    for (int i = 0; i < frames; ++i)
+    {
+        double time = i / rate;
+
+        sensor_msgs::ImagePtr image(new sensor_msgs::Image());
+        scene.render(time, *image);
+        image->header.stamp = start + ros::Duration(time);
+
+        sensor_msgs::CameraInfoPtr info(
+            new sensor_msgs::CameraInfo(scene.camera_info()));
+        info->header.stamp = image->header.stamp;
+
+        const int pose_size = dbot::PoseVector::SizeAtCompileTime;
+        Eigen::VectorXd ground_truth(scene.object_count() * pose_size);
+        for (int j = 0; j < scene.object_count(); ++j)
+        {
+            Eigen::Affine3d pose = scene.object_pose(j, time);
+
+            dbot::PoseVector pose_vector;
+            pose_vector.position() = pose.translation();
+            pose_vector.orientation().quaternion(
+                Eigen::Quaterniond(pose.rotation()));
+            ground_truth.segment(j * pose_size, pose_size) = pose_vector;
+        }
+
+        data_set->AddFrame(image, info, ground_truth);
+    }
+
+    if (!data_set->Store()) return 1;
+
+    std::cout << "generated " << frames << " frames in " << output_dir
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file replay_dataset.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Tracks a TrackingDataset headless, i.e. without a ROS master, and writes
+ * the estimates into a binary tracking result file. The tracker is
+ * initialized with the ground truth of the first replayed frame.
+ *
+ * The tracker is configured by the same YAML files which are loaded by the
+ * tracker launch files. Later files override earlier ones.
+ *
+ * Usage:
+ *   replay_dataset <particle|gaussian> <dataset_dir> <results.bin>
+ *                  <config.yaml>... [--simulated-clock [rate]]
+ *                  [--first-frame n] [--frames n]
+ *                  [--decoder-threads n] [--lookahead n]
+ *
+ * Example:
+ *   replay_dataset particle /data/session results.bin
+ *                  config/object.yaml config/camera.yaml
+ *                  config/particle_tracker.yaml
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <dbot/camera_data.h>
+#include <dbot_ros/util/data_set_camera_data_provider.h>
+#include <dbot_ros/util/object_state_conversion.h>
+#include <dbot_ros/util/replay_driver.h>
+#include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/tracker_factory.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <dbot_ros/util/yaml_config.h>
+#include <iostream>
+#include <memory>
+#include <ros/time.h>
+#include <string>
+#include <vector>
+
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  replay_dataset <particle|gaussian> <dataset_dir> "
+                 "<results.bin> <config.yaml>... [--simulated-clock [rate]] "
+                 "[--first-frame n] [--frames n] [--decoder-threads n] "
+                 "[--lookahead n]"
+              << std::endl;
+    return 1;
+}
+
+template <typename Tracker>
+static int replay(
+    const std::shared_ptr<Tracker>& tracker,
+    const std::shared_ptr<TrackingDataset>& data_set,
+    const std::shared_ptr<dbot::DataSetCameraDataProvider>& camera_provider,
+    int object_count,
+    const typename dbot::ReplayDriver<Tracker>::Parameters& params,
+    const std::string& results_file)
+{
+    typedef typename dbot::ReplayDriver<Tracker>::State State;
+
+    dbot::ReplayDriver<Tracker> driver(
+        tracker, data_set, camera_provider, object_count, params);
+
+    if (!driver.initialize_from_ground_truth())
+    {
+        std::cerr << "cannot initialize the tracker from the ground truth"
+                  << std::endl;
+        return 1;
+    }
+
+    dbot::TrackingResultWriter writer(
+        results_file, dbot::TrackingResultLayout::object_states(object_count));
+    if (!writer.is_open()) return 1;
+
+    auto start       = std::chrono::steady_clock::now();
+    auto frame_count = driver.run(
+        [&](size_t, const sensor_msgs::Image& image, const State& state)
+        {
+            writer.write(
+                ri::to_object_states(state, object_count, image.header));
+        });
+    std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+    if (!writer.close())
+    {
+        std::cerr << "could not write file " << results_file << std::endl;
+        return 1;
+    }
+
+    std::cout << "tracked " << frame_count << " frames ("
+              << driver.skipped_frames() << " skipped) in "
+              << duration.count() << " s, "
+              << frame_count / duration.count() << " frames/s" << std::endl;
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 5) return usage();
+
+    std::string tracker_type = argv[1];
+    std::string data_set_dir = argv[2];
+    std::string results_file = argv[3];
+
+    dbot::YamlConfig config;
+    bool simulated_clock = false;
+    double clock_rate    = 1.0;
+    size_t first_frame   = 0;
+    size_t frame_count   = 0;
+    int decoder_threads  = 2;
+    int lookahead        = 8;
+    for (int i = 4; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--simulated-clock")
+        {
+            simulated_clock = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                clock_rate = std::atof(argv[++i]);
+            }
+        }
+        else if (arg == "--first-frame" && i + 1 < argc)
+        {
+            first_frame = std::strtoul(argv[++i], 0, 10);
+        }
+        else if (arg == "--frames" && i + 1 < argc)
+        {
+            frame_count = std::strtoul(argv[++i], 0, 10);
+        }
+        else if (arg == "--decoder-threads" && i + 1 < argc)
+        {
+            decoder_threads = std::atoi(argv[++i]);
+        }
+        else if (arg == "--lookahead" && i + 1 < argc)
+        {
+            lookahead = std::atoi(argv[++i]);
+        }
+        else if (!config.load(arg))
+        {
+            return 1;
+        }
+    }
+
+    if (tracker_type != "particle" && tracker_type != "gaussian")
+    {
+        return usage();
+    }
+
+    // read and validated as by the tracker nodes
+    dbot::OfflineTrackerConfig tracker_config;
+    if (!dbot::read(config, tracker_type, tracker_config)) return 1;
+
+    // rosbag and message time stamps require the time source without a node
+    ros::Time::init();
+
+    /* ------------------------------ */
+    /* - Dataset and camera data    - */
+    /* ------------------------------ */
+    // the depth images are read from the bag by the decoder threads of the
+    // replay rather than on loading
+    auto data_set =
+        std::make_shared<TrackingDataset>(data_set_dir, false, 6, false);
+    if (data_set->Size() == 0)
+    {
+        std::cerr << "dataset " << data_set_dir << " is empty" << std::endl;
+        return 1;
+    }
+
+    auto camera_provider = std::make_shared<dbot::DataSetCameraDataProvider>(
+        data_set, tracker_config.camera.downsampling_factor);
+    auto camera_data = std::make_shared<dbot::CameraData>(camera_provider);
+    int object_count = tracker_config.object.meshes.size();
+
+    /* ------------------------------ */
+    /* - Replay                     - */
+    /* ------------------------------ */
+    if (tracker_type == "particle")
+    {
+        dbot::ReplayDriver<dbot::ParticleTracker>::Parameters params;
+        params.simulated_clock = simulated_clock;
+        params.clock_rate      = clock_rate;
+        params.first_frame     = first_frame;
+        params.frame_count     = frame_count;
+        params.decoder_threads = decoder_threads;
+        params.lookahead       = lookahead;
+
+        return replay(
+            dbot::create_particle_tracker(tracker_config, camera_data),
+            data_set,
+            camera_provider,
+            object_count,
+            params,
+            results_file);
+    }
+
+    if (tracker_type == "gaussian")
+    {
+        dbot::ReplayDriver<dbot::GaussianTracker>::Parameters params;
+        params.simulated_clock = simulated_clock;
+        params.clock_rate      = clock_rate;
+        params.first_frame     = first_frame;
+        params.frame_count     = frame_count;
+        params.decoder_threads = decoder_threads;
+        params.lookahead       = lookahead;
+
+        return replay(
+            dbot::create_gaussian_tracker(tracker_config, camera_data),
+            data_set,
+            camera_provider,
+            object_count,
+            params,
+            results_file);
+    }
+
+    return usage();
+}
@@ -0,0 +1,430 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file track_dataset_chunks.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Tracks a TrackingDataset offline in parallel chunks, e.g. to annotate long
+ * recordings, and writes the stitched estimates into a binary tracking
+ * result file.
+ *
+ * The dataset is split into chunks of --chunk-frames frames. A chunk is
+ * tracked by its own tracker, starting --overlap frames before the chunk to
+ * warm up the filter. The tracker is seeded with the ground truth of its
+ * first (warm-up) frame. A chunk without ground truth at that frame, or any
+ * chunk with --seed handoff, is not seeded but tracked by the tracker of the
+ * preceding chunk which simply continues. Hence, handoff chunks are tracked
+ * sequentially while seeded chunks are tracked in parallel. GPU particle
+ * trackers share the device and track all chunks sequentially.
+ *
+ * Frames which cannot be decoded are reported and the tool exits with
+ * status 1 without writing results.
+ *
+ * After stitching, the estimates of the last warm-up frame of every seeded
+ * chunk are compared to the estimates of the preceding chunk for that frame.
+ * Boundaries exceeding the admissible difference are reported and the tool
+ * exits with status 2.
+ *
+ * Usage:
+ *   track_dataset_chunks <particle|gaussian> <dataset_dir> <results.bin>
+ *                        <config.yaml>... [--chunk-frames n] [--overlap n]
+ *                        [--threads n] [--seed ground_truth|handoff]
+ *                        [--max-translation-diff m] [--max-rotation-diff rad]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <dbot/camera_data.h>
+#include <dbot/pose/pose_vector.h>
+#include <dbot/pose/pose_velocity_vector.h>
+#include <dbot_ros/util/data_set_camera_data_provider.h>
+#include <dbot_ros/util/object_state_conversion.h>
+#include <dbot_ros/util/replay_driver.h>
+#include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/tracker_factory.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <dbot_ros/util/yaml_config.h>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ros/time.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::vector<dbot_ros_msgs::ObjectState> ObjectStates;
+
+/**
+ * \brief Contiguous frame range tracked by a single tracker
+ */
+struct Job
+{
+    /** \brief First tracked frame, i.e. start of the warm-up */
+    size_t warm_up_begin;
+    /** \brief First frame whose estimate is kept */
+    size_t begin;
+    /** \brief One past the last tracked frame */
+    size_t end;
+};
+
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  track_dataset_chunks <particle|gaussian> <dataset_dir> "
+                 "<results.bin> <config.yaml>... [--chunk-frames n] "
+                 "[--overlap n] [--threads n] [--seed ground_truth|handoff] "
+                 "[--max-translation-diff m] [--max-rotation-diff rad]"
+              << std::endl;
+    return 1;
+}
+
+static bool has_ground_truth(const std::shared_ptr<TrackingDataset>& data_set,
+                             size_t frame,
+                             int object_count)
+{
+    auto size = data_set->GetGroundTruth(frame).size();
+
+    return size == object_count * dbot::PoseVector::SizeAtCompileTime ||
+           size == object_count * dbot::PoseVelocityVector::SizeAtCompileTime;
+}
+
+/**
+ * \brief Largest translation and rotation difference over all objects
+ */
+static void difference(const ObjectStates& a,
+                       const ObjectStates& b,
+                       double& translation,
+                       double& rotation)
+{
+    translation = 0.0;
+    rotation    = 0.0;
+
+    for (size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+    {
+        auto pose_a = ri::to_pose_vector(a[i].pose.pose);
+        auto pose_b = ri::to_pose_vector(b[i].pose.pose);
+
+        translation = std::max(
+            translation, (pose_a.position() - pose_b.position()).norm());
+        rotation = std::max(rotation,
+                            pose_a.orientation().quaternion().angularDistance(
+                                pose_b.orientation().quaternion()));
+    }
+}
+
+template <typename Tracker>
+static bool track(
+    const std::function<std::shared_ptr<Tracker>(
+        const std::shared_ptr<dbot::CameraData>&)>& create_tracker,
+    const dbot::OfflineTrackerConfig& config,
+    const std::shared_ptr<TrackingDataset>& data_set,
+    int object_count,
+    const Job& job,
+    std::mutex& construction_mutex,
+    std::vector<ObjectStates>& estimates,
+    std::vector<ObjectStates>& warm_up_estimates)
+{
+    typedef typename dbot::ReplayDriver<Tracker>::State State;
+
+    std::shared_ptr<Tracker> tracker;
+    std::shared_ptr<dbot::DataSetCameraDataProvider> camera_provider;
+    {
+        // model loading is not thread safe
+        std::lock_guard<std::mutex> lock(construction_mutex);
+
+        camera_provider = std::make_shared<dbot::DataSetCameraDataProvider>(
+            data_set, config.camera.downsampling_factor);
+        tracker =
+            create_tracker(std::make_shared<dbot::CameraData>(camera_provider));
+    }
+
+    typename dbot::ReplayDriver<Tracker>::Parameters params;
+    params.first_frame = job.warm_up_begin;
+    params.frame_count = job.end - job.warm_up_begin;
+
+    dbot::ReplayDriver<Tracker> driver(
+        tracker, data_set, camera_provider, object_count, params);
+
+    if (!driver.initialize_from_ground_truth()) return false;
+
+    warm_up_estimates.resize(job.begin - job.warm_up_begin);
+
+    // every job owns a disjoint range of estimates
+    driver.run(
+        [&](size_t frame, const sensor_msgs::Image& image, const State& state)
+        {
+            auto object_states =
+                ri::to_object_states(state, object_count, image.header);
+
+            if (frame < job.begin)
+            {
+                warm_up_estimates[frame - job.warm_up_begin] = object_states;
+            }
+            else
+            {
+                estimates[frame] = object_states;
+            }
+        });
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 5) return usage();
+
+    std::string tracker_type = argv[1];
+    std::string data_set_dir = argv[2];
+    std::string results_file = argv[3];
+
+    dbot::YamlConfig yaml_config;
+    size_t chunk_frames         = 300;
+    size_t overlap              = 30;
+    int threads                 = 0;
+    bool handoff                = false;
+    double max_translation_diff = 0.01;
+    double max_rotation_diff    = 0.05;
+    for (int i = 4; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--chunk-frames" && i + 1 < argc)
+        {
+            chunk_frames = std::max(1ul, std::strtoul(argv[++i], 0, 10));
+        }
+        else if (arg == "--overlap" && i + 1 < argc)
+        {
+            overlap = std::strtoul(argv[++i], 0, 10);
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            threads = std::atoi(argv[++i]);
+        }
+        else if (arg == "--seed" && i + 1 < argc)
+        {
+            handoff = std::string(argv[++i]) == "handoff";
+        }
+        else if (arg == "--max-translation-diff" && i + 1 < argc)
+        {
+            max_translation_diff = std::atof(argv[++i]);
+        }
+        else if (arg == "--max-rotation-diff" && i + 1 < argc)
+        {
+            max_rotation_diff = std::atof(argv[++i]);
+        }
+        else if (!yaml_config.load(arg))
+        {
+            return 1;
+        }
+    }
+
+    if (tracker_type != "particle" && tracker_type != "gaussian")
+    {
+        return usage();
+    }
+
+    // read and validated as by the tracker nodes
+    dbot::OfflineTrackerConfig config;
+    if (!dbot::read(yaml_config, tracker_type, config)) return 1;
+
+    // rosbag and message time stamps require the time source without a node
+    ros::Time::init();
+
+    auto data_set = std::make_shared<TrackingDataset>(data_set_dir);
+    size_t frame_count = data_set->Size();
+
+    int object_count = config.object.meshes.size();
+
+    if (frame_count == 0 || !has_ground_truth(data_set, 0, object_count))
+    {
+        std::cerr << "dataset " << data_set_dir
+                  << " is empty or has no ground truth for the first frame"
+                  << std::endl;
+        return 1;
+    }
+
+    /* ------------------------------ */
+    /* - Split into jobs            - */
+    /* ------------------------------ */
+    std::vector<Job> jobs;
+    for (size_t begin = 0; begin < frame_count; begin += chunk_frames)
+    {
+        size_t end           = std::min(frame_count, begin + chunk_frames);
+        size_t warm_up_begin = begin > overlap ? begin - overlap : 0;
+
+        if (jobs.empty() ||
+            (!handoff &&
+             has_ground_truth(data_set, warm_up_begin, object_count)))
+        {
+            jobs.push_back({jobs.empty() ? 0 : warm_up_begin, begin, end});
+        }
+        else
+        {
+            // handoff, the previous tracker continues
+            jobs.back().end = end;
+        }
+    }
+
+    if (threads <= 0) threads = std::thread::hardware_concurrency();
+    bool use_gpu = tracker_type == "particle" &&
+                   config.particle_filter.observation.use_gpu;
+    if (use_gpu && threads > 1)
+    {
+        std::cerr << "GPU particle trackers track the chunks sequentially"
+                  << std::endl;
+        threads = 1;
+    }
+    threads = std::max(1, std::min<int>(threads, jobs.size()));
+
+    std::cout << frame_count << " frames in " << jobs.size()
+              << " independently seeded chunks on " << threads << " threads"
+              << std::endl;
+
+    /* ------------------------------ */
+    /* - Track                      - */
+    /* ------------------------------ */
+    std::vector<ObjectStates> estimates(frame_count);
+    std::vector<std::vector<ObjectStates>> warm_up_estimates(jobs.size());
+    std::vector<char> succeeded(jobs.size(), false);
+    std::atomic<size_t> next_job(0);
+    std::mutex construction_mutex;
+
+    auto worker = [&]()
+    {
+        for (size_t j = next_job++; j < jobs.size(); j = next_job++)
+        {
+            if (tracker_type == "gaussian")
+            {
+                succeeded[j] = track<dbot::GaussianTracker>(
+                    [&](const std::shared_ptr<dbot::CameraData>& camera_data)
+                    {
+                        return dbot::create_gaussian_tracker(config,
+                                                             camera_data);
+                    },
+                    config,
+                    data_set,
+                    object_count,
+                    jobs[j],
+                    construction_mutex,
+                    estimates,
+                    warm_up_estimates[j]);
+            }
+            else
+            {
+                succeeded[j] = track<dbot::ParticleTracker>(
+                    [&](const std::shared_ptr<dbot::CameraData>& camera_data)
+                    {
+                        return dbot::create_particle_tracker(config,
+                                                             camera_data);
+                    },
+                    config,
+                    data_set,
+                    object_count,
+                    jobs[j],
+                    construction_mutex,
+                    estimates,
+                    warm_up_estimates[j]);
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i) workers.emplace_back(worker);
+    for (auto& thread : workers) thread.join();
+    std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+
+    for (size_t j = 0; j < jobs.size(); ++j)
+    {
+        if (!succeeded[j])
+        {
+            std::cerr << "initializing the tracker of frames "
+                      << jobs[j].warm_up_begin << " to " << jobs[j].end
+                      << " from the ground truth failed" << std::endl;
+            return 1;
+        }
+    }
+
+    // the replay skips frames which failed to decode, these have no
+    // estimates
+    bool decoded = true;
+    for (size_t j = 0; j < jobs.size(); ++j)
+    {
+        auto& job = jobs[j];
+        for (size_t frame = job.warm_up_begin; frame < job.end; ++frame)
+        {
+            bool missing =
+                frame < job.begin
+                    ? warm_up_estimates[j][frame - job.warm_up_begin].empty()
+                    : estimates[frame].empty();
+            if (!missing) continue;
+
+            std::cerr << "frame " << frame << " of chunk " << j
+                      << " (frames " << job.warm_up_begin << " to "
+                      << job.end << ") could not be decoded" << std::endl;
+            decoded = false;
+        }
+    }
+    if (!decoded) return 1;
+
+    std::cout << "tracked " << frame_count << " frames in " << duration.count()
+              << " s, " << frame_count / duration.count() << " frames/s"
+              << std::endl;
+
+    /* ------------------------------ */
+    /* - Check consistency          - */
+    /* ------------------------------ */
+    // the warm-up estimates converge towards the estimates of the preceding
+    // chunk. compare both at the last warm-up frame.
+    bool consistent = true;
+    for (size_t j = 1; j < jobs.size(); ++j)
+    {
+        if (warm_up_estimates[j].empty()) continue;
+
+        size_t frame = jobs[j].begin - 1;
+        double translation;
+        double rotation;
+        difference(warm_up_estimates[j].back(),
+                   estimates[frame],
+                   translation,
+                   rotation);
+
+        bool admissible = translation <= max_translation_diff &&
+                          rotation <= max_rotation_diff;
+        consistent = consistent && admissible;
+
+        std::cout << "frame " << frame << ": translation difference "
+                  << translation << " m, rotation difference " << rotation
+                  << " rad" << (admissible ? "" : " INCONSISTENT")
+                  << std::endl;
+    }
+
+    /* ------------------------------ */
+    /* - Stitch                     - */
+    /* ------------------------------ */
+    dbot::TrackingResultWriter writer(
+        results_file, dbot::TrackingResultLayout::object_states(object_count));
+    if (!writer.is_open()) return 1;
+
+    for (auto& object_states : estimates)
+    {
+        if (!writer.write(object_states)) return 1;
+    }
+    if (!writer.close()) return 1;
+
+    return consistent ? 0 : 2;
+}
@@ -23,14 +23,18 @@
 #include <dbot/camera_data.h>
 #include <dbot/pose/free_floating_rigid_bodies_state.h>
 #include <dbot/tracker/gaussian_tracker.h>
+#include <dbot_ros/object_tracker_node.h>
 #include <dbot_ros/object_tracker_publisher.h>
 #include <dbot_ros/object_tracker_ros.h>
-#include <dbot_ros/util/interactive_marker_initializer.h>
+#include <dbot_ros/util/initial_pose_source.h>
 #include <dbot_ros/util/ros_camera_data_provider.h>
 #include <dbot_ros/util/ros_interface.h>
-#include <dbot_ros_msgs/ObjectState.h>
+#include <dbot_ros/util/startup_timeline.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/tracker_factory.h>
 #include <fl/util/profiling.hpp>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <ros/package.h>
 #include <ros/ros.h>
@@ -42,168 +46,146 @@ int main(int argc, char** argv)
     ros::init(argc, argv, "gaussian_tracker");
     ros::NodeHandle nh("~");
 
-    /* ------------------------------ */
-    /* - Parameters                 - */
-    /* ------------------------------ */
-    // tracker's main parameter container
-    dbot::GaussianTrackerBuilder::Parameters params;
-
-    // camera data
-    dbot::CameraData::Resolution resolution;
-    std::string camera_info_topic;
-    std::string depth_image_topic;
-    int downsampling_factor;
-
-    // object data
-    std::string object_package;
-    std::string object_directory;
-    std::vector<std::string> object_meshes;
-
     // parameter shorthand prefix
     std::string pre = "gaussian_filter/";
 
     /* ------------------------------ */
-    /* - Read out parameters        - */
+    /* - Configuration              - */
     /* ------------------------------ */
-    // get object parameters
-    /// \todo nh.getParam does not check whether the parameter exists in the
-    /// config file. this is dangerous, we should use ri::read instead
-
-    nh.getParam("object/meshes", object_meshes);
-    nh.getParam("object/package", object_package);
-    nh.getParam("object/directory", object_directory);
-
-    params.ori.package_path(ros::package::getPath(object_package));
-    params.ori.directory(object_directory);
-    params.ori.meshes(object_meshes);
-
-    // get filter parameters
-    nh.getParam(pre + "unscented_transform/alpha", params.ut_alpha);
-    nh.getParam(pre + "moving_average_update_rate",
-                params.moving_average_update_rate);
-    nh.getParam(pre + "center_object_frame", params.center_object_frame);
-
-    nh.getParam(pre + "observation/tail_weight",
-                params.observation.tail_weight);
-    nh.getParam(pre + "observation/bg_depth", params.observation.bg_depth);
-    nh.getParam(pre + "observation/fg_noise_std",
-                params.observation.fg_noise_std);
-    nh.getParam(pre + "observation/bg_noise_std",
-                params.observation.bg_noise_std);
-    nh.getParam(pre + "observation/uniform_tail_max",
-                params.observation.uniform_tail_max);
-    nh.getParam(pre + "observation/uniform_tail_min",
-                params.observation.uniform_tail_min);
-
-    // state transition parameters
-    nh.getParam(pre + "object_transition/linear_sigma_x",
-                params.object_transition.linear_sigma_x);
-    nh.getParam(pre + "object_transition/linear_sigma_y",
-                params.object_transition.linear_sigma_y);
-    nh.getParam(pre + "object_transition/linear_sigma_z",
-                params.object_transition.linear_sigma_z);
-
-    nh.getParam(pre + "object_transition/angular_sigma_x",
-                params.object_transition.angular_sigma_x);
-    nh.getParam(pre + "object_transition/angular_sigma_y",
-                params.object_transition.angular_sigma_y);
-    nh.getParam(pre + "object_transition/angular_sigma_z",
-                params.object_transition.angular_sigma_z);
-
-    nh.getParam(pre + "object_transition/velocity_factor",
-                params.object_transition.velocity_factor);
-    params.object_transition.part_count = object_meshes.size();
-
-    // camera parameters
-    nh.getParam("camera_info_topic", camera_info_topic);
-    nh.getParam("depth_image_topic", depth_image_topic);
-    nh.getParam("downsampling_factor", downsampling_factor);
-    nh.getParam("resolution/width", resolution.width);
-    nh.getParam("resolution/height", resolution.height);
+    // read and validated once, all missing or mistyped parameters are
+    // reported together
+    dbot::ParameterReader reader(nh);
+    dbot::CameraConfig camera_config;
+    dbot::ObjectConfig object_config;
+    dbot::GaussianFilterConfig filter_config;
+    dbot::ObjectStatePublisher::Parameters publisher_params;
+    dbot::RuntimeConfig runtime_config;
+    dbot::read(reader, camera_config);
+    dbot::read(reader, "object/", object_config);
+    dbot::read(reader, pre, filter_config);
+    dbot::read(reader, "object_state_publisher/", publisher_params);
+    dbot::read(reader, runtime_config);
+    if (!reader.report()) return 1;
+
+    auto ori = object_config.ori();
+
+    // The camera info wait and the interactive initialization run
+    // concurrently with the tracker build. Only the tracker initialization
+    // waits for the initial poses
+    dbot::StartupTimeline startup;
 
     /* ------------------------------ */
     /* - Setup camera data          - */
     /* ------------------------------ */
-    // setup camera data
-    auto camera_data_provider = std::shared_ptr<dbot::CameraDataProvider>(
+    // setup camera data, this waits for the camera info
+    auto camera_data_provider = std::shared_ptr<dbot::RosCameraDataProvider>(
         new dbot::RosCameraDataProvider(nh,
-                                        camera_info_topic,
-                                        depth_image_topic,
-                                        resolution,
-                                        downsampling_factor,
+                                        camera_config.camera_info_topic,
+                                        camera_config.depth_image_topic,
+                                        camera_config.resolution,
+                                        camera_config.downsampling_factor,
                                         2.0));
-    auto camera_data = std::make_shared<dbot::CameraData>(camera_data_provider);
+    std::shared_future<std::shared_ptr<dbot::CameraData>> camera_data_task =
+        std::async(std::launch::async, [camera_data_provider, &startup]() {
+            auto camera_data =
+                std::make_shared<dbot::CameraData>(camera_data_provider);
+            startup.done("camera info");
+            return camera_data;
+        }).share();
 
-    // finally, set number of pixels
-    params.observation.sensors = camera_data->pixels();
+    /* ------------------------------ */
+    /* - Initial poses              - */
+    /* ------------------------------ */
+    // the initial pose sources are served by the spinner. The source which
+    // provided the poses is kept alive, e.g. to keep the interactive markers
+    ros::AsyncSpinner spinner(2);
+    spinner.start();
+
+    std::shared_ptr<dbot::InitialPoseSource> initial_pose_source;
+    auto initial_poses_task = std::async(std::launch::async, [&]() {
+        std::vector<geometry_msgs::Pose> poses;
+        initial_pose_source =
+            dbot::wait_for_initial_poses(nh,
+                                         "initial_pose/",
+                                         ori,
+                                         camera_data_task.get()->frame_id(),
+                                         poses);
+        if (initial_pose_source) startup.done("initial poses");
+        return poses;
+    });
 
     /* ------------------------------ */
-    /* - Initialize interactively   - */
+    /* - Create the tracker         - */
     /* ------------------------------ */
-    opi::InteractiveMarkerInitializer object_initializer(
-        camera_data->frame_id(),
-        params.ori.package(),
-        params.ori.directory(),
-        params.ori.meshes(),
-        {},
-        true);
-    if (!object_initializer.wait_for_object_poses())
+    auto camera_data = camera_data_task.get();
+
+    // builds the tracker from the filter configuration at startup and when
+    // the parameters are reloaded. This loads the object model
+    auto build_tracker = [&](const dbot::GaussianFilterConfig& config) {
+        return dbot::create_gaussian_tracker(config, ori, camera_data);
+    };
+
+    // the initial tracker is built on the main thread which runs it later on
+    auto tracker = build_tracker(filter_config);
+    startup.done("tracker build");
+
+    auto initial_ros_poses = initial_poses_task.get();
+    if (!initial_pose_source)
     {
-        ROS_INFO("Setting object poses was interrupted.");
+        ROS_INFO("No initial object poses available.");
         return 0;
     }
 
-    auto initial_ros_poses = object_initializer.poses();
     std::vector<Tracker::State> initial_poses;
-    initial_poses.push_back(Tracker::State(params.ori.count_meshes()));
+    initial_poses.push_back(Tracker::State(ori.count_meshes()));
     int i = 0;
     for (auto& ros_pose : initial_ros_poses)
     {
         initial_poses[0].component(i++) = ri::to_pose_velocity_vector(ros_pose);
     }
 
-    /* ------------------------------ */
-    /* - Create the tracker         - */
-    /* ------------------------------ */
-    auto tracker_builder = dbot::GaussianTrackerBuilder(params, camera_data);
-
-    auto tracker = tracker_builder.build();
-    tracker->initialize(initial_poses);
-
     /* ------------------------------ */
     /* - Tracker publisher          - */
     /* ------------------------------ */
-    int object_color[3];
-    nh.getParam(pre + "object_color/R", object_color[0]);
-    nh.getParam(pre + "object_color/G", object_color[1]);
-    nh.getParam(pre + "object_color/B", object_color[2]);
-    auto tracker_publisher = dbot::ObjectStatePublisher(
-        params.ori, object_color[0], object_color[1], object_color[2]);
+    auto tracker_publisher =
+        dbot::ObjectStatePublisher(ori,
+                                   filter_config.object_color[0],
+                                   filter_config.object_color[1],
+                                   filter_config.object_color[2],
+                                   publisher_params);
 
     /* ------------------------------ */
     /* - Create and run tracker     - */
     /* - node                       - */
     /* ------------------------------ */
-    dbot::ObjectTrackerRos<dbot::GaussianTracker> ros_object_tracker(
-        tracker, camera_data, params.ori.count_meshes());
-
-    ros::Subscriber subscriber = nh.subscribe(
-        depth_image_topic,
-        1,
-        &dbot::ObjectTrackerRos<dbot::GaussianTracker>::update_obsrv,
-        &ros_object_tracker);
+    dbot::ObjectTrackerRos<Tracker> ros_object_tracker(
+        tracker, camera_data, ori.count_meshes());
+    ros_object_tracker.initialize(initial_poses);
 
-    while (ros::ok())
-    {
-        if (ros_object_tracker.run_once())
-        {
-            tracker_publisher.publish(
-                ros_object_tracker.current_state_messages());
-        }
-        ros::spinOnce();
-    }
-
-    ros::spin();
+    /* ------------------------------ */
+    /* - Runtime features           - */
+    /* ------------------------------ */
+    dbot::ObjectTrackerNode<Tracker> node(nh,
+                                          ros_object_tracker,
+                                          tracker_publisher,
+                                          ori,
+                                          runtime_config,
+                                          camera_data_provider->camera_info());
+    node.startup_timeline(startup);
+
+    // ~reinitialize rebuilds the tracker from the current filter parameters
+    // in the background and initializes it at the current estimate. The
+    // covariance is not carried over since GaussianTracker does not expose
+    // it.
+    node.reinitializable([&]() -> std::shared_ptr<Tracker> {
+        dbot::ParameterReader reader(nh);
+        dbot::GaussianFilterConfig config;
+        dbot::read(reader, pre, config);
+        if (!reader.report()) return std::shared_ptr<Tracker>();
+        return build_tracker(config);
+    });
+
+    node.run(camera_config.depth_image_topic);
 
     return 0;
 }
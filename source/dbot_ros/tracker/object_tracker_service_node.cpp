@@ -24,11 +24,14 @@
 #include <dbot/pose/free_floating_rigid_bodies_state.h>
 #include <dbot/simple_wavefront_object_loader.h>
 #include <dbot/tracker/particle_tracker.h>
+#include <dbot_ros/object_tracker_node.h>
 #include <dbot_ros/object_tracker_publisher.h>
 #include <dbot_ros/object_tracker_ros.h>
 #include <dbot_ros/util/interactive_marker_initializer.h>
 #include <dbot_ros/util/ros_camera_data_provider.h>
 #include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/tracker_factory.h>
 #include <fl/util/profiling.hpp>
 #include <fstream>
 #include <memory>
@@ -41,52 +44,26 @@
 static bool running = false;
 static std::thread tracker_thread;
 
+// read and validated once at startup and shared by all tracking requests
+static dbot::CameraConfig camera_config;
+static dbot::MeshDecimationConfig decimation_config;
+static dbot::ParticleFilterConfig filter_config;
+static dbot::ObjectStatePublisher::Parameters publisher_params;
+static dbot::RuntimeConfig runtime_config;
+
 void run(dbot::ObjectResourceIdentifier ori, dbot::PoseVelocityVector pose)
 {
     ros::NodeHandle nh("~");
 
-    // parameter shorthand prefix
-    std::string pre = "particle_filter/";
-
-    /* ------------------------------ */
-    /* - Create the object model    - */
-    /* ------------------------------ */
-
-    // Use the ORI to load the object model usign the
-    // SimpleWavefrontObjectLoader
-    auto object_model_loader = std::shared_ptr<dbot::ObjectModelLoader>(
-        new dbot::SimpleWavefrontObjectModelLoader(ori));
-
-    // Load the model usign the simple wavefront load and center the
-    // frames
-    // of all object part meshes
-    bool center_object_frame;
-
-    /// \todo nh.getParam does not check whether the parameter exists in the
-    /// config file. this is dangerous, we should use ri::read instead
-    nh.getParam(pre + "center_object_frame", center_object_frame);
-    auto object_model = std::make_shared<dbot::ObjectModel>(
-        object_model_loader, center_object_frame);
-
     /* ------------------------------ */
     /* - Setup camera data          - */
     /* ------------------------------ */
-    int downsampling_factor;
-    std::string camera_info_topic;
-    std::string depth_image_topic;
-    dbot::CameraData::Resolution resolution;
-    nh.getParam("camera_info_topic", camera_info_topic);
-    nh.getParam("depth_image_topic", depth_image_topic);
-    nh.getParam("downsampling_factor", downsampling_factor);
-    nh.getParam("resolution/width", resolution.width);
-    nh.getParam("resolution/height", resolution.height);
-
-    auto camera_data_provider = std::shared_ptr<dbot::CameraDataProvider>(
+    auto camera_data_provider = std::shared_ptr<dbot::RosCameraDataProvider>(
         new dbot::RosCameraDataProvider(nh,
-                                        camera_info_topic,
-                                        depth_image_topic,
-                                        resolution,
-                                        downsampling_factor,
+                                        camera_config.camera_info_topic,
+                                        camera_config.depth_image_topic,
+                                        camera_config.resolution,
+                                        camera_config.downsampling_factor,
                                         60.0));
     // Create camera data from the RosCameraDataProvider which takes the
     // data
@@ -94,136 +71,77 @@ void run(dbot::ObjectResourceIdentifier ori, dbot::PoseVelocityVector pose)
     auto camera_data = std::make_shared<dbot::CameraData>(camera_data_provider);
 
     /* ------------------------------ */
-    /* - Few types we will be using - */
-    /* ------------------------------ */
-    typedef dbot::FreeFloatingRigidBodiesState<> State;
-    typedef dbot::ParticleTracker Tracker;
-    typedef dbot::ParticleTrackerBuilder<Tracker> TrackerBuilder;
-    typedef TrackerBuilder::TransitionBuilder TransitionBuilder;
-    typedef TrackerBuilder::SensorBuilder SensorBuilder;
-
-
-    /* ------------------------------ */
-    /* - State transition function  - */
-    /* ------------------------------ */
-    // We will use a linear observation model built by the object transition
-    // model builder. The linear model will generate a random walk.
-    dbot::ObjectTransitionBuilder<State>::Parameters params_state;
-    // state transition parameters
-    nh.getParam(pre + "object_transition/linear_sigma_x",
-                params_state.linear_sigma_x);
-    nh.getParam(pre + "object_transition/linear_sigma_y",
-                params_state.linear_sigma_y);
-    nh.getParam(pre + "object_transition/linear_sigma_z",
-                params_state.linear_sigma_z);
-
-    nh.getParam(pre + "object_transition/angular_sigma_x",
-                params_state.angular_sigma_x);
-    nh.getParam(pre + "object_transition/angular_sigma_y",
-                params_state.angular_sigma_y);
-    nh.getParam(pre + "object_transition/angular_sigma_z",
-                params_state.angular_sigma_z);
-    nh.getParam(pre + "object_transition/velocity_factor",
-                params_state.velocity_factor);
-    params_state.part_count = 1;
-
-    auto state_trans_builder = std::shared_ptr<TransitionBuilder>(
-        new dbot::ObjectTransitionBuilder<State>(params_state));
-
-    /* ------------------------------ */
-    /* - Observation model          - */
+    /* - Create the object model    - */
     /* ------------------------------ */
-    dbot::RbSensorBuilder<State>::Parameters params_obsrv;
-    nh.getParam(pre + "use_gpu", params_obsrv.use_gpu);
-
-    if (params_obsrv.use_gpu)
-    {
-        nh.getParam(pre + "gpu/sample_count", params_obsrv.sample_count);
-    }
-    else
-    {
-        nh.getParam(pre + "cpu/sample_count", params_obsrv.sample_count);
-    }
-
-    nh.getParam(pre + "observation/occlusion/p_occluded_visible",
-                params_obsrv.occlusion.p_occluded_visible);
-    nh.getParam(pre + "observation/occlusion/p_occluded_occluded",
-                params_obsrv.occlusion.p_occluded_occluded);
-    nh.getParam(pre + "observation/occlusion/initial_occlusion_prob",
-                params_obsrv.occlusion.initial_occlusion_prob);
-
-    nh.getParam(pre + "observation/kinect/tail_weight",
-                params_obsrv.kinect.tail_weight);
-    nh.getParam(pre + "observation/kinect/model_sigma",
-                params_obsrv.kinect.model_sigma);
-    nh.getParam(pre + "observation/kinect/sigma_factor",
-                params_obsrv.kinect.sigma_factor);
-    params_obsrv.delta_time = 1. / 30.;
+    // optional level of detail, by default a depth pixel at the nearest
+    // expected object distance
+    auto decimation =
+        decimation_config.levels(ori, camera_data->camera_matrix()(0, 0));
 
-    // gpu only parameters
-    nh.getParam(pre + "gpu/use_custom_shaders",
-                params_obsrv.use_custom_shaders);
-    nh.getParam(pre + "gpu/vertex_shader_file",
-                params_obsrv.vertex_shader_file);
-    nh.getParam(pre + "gpu/fragment_shader_file",
-                params_obsrv.fragment_shader_file);
-    nh.getParam(pre + "gpu/geometry_shader_file",
-                params_obsrv.geometry_shader_file);
-
-    auto sensor_builder =
-        std::shared_ptr<SensorBuilder>(new dbot::RbSensorBuilder<State>(
-            object_model, camera_data, params_obsrv));
+    // meshes are parsed once and loaded from the binary cache afterwards
+    auto object_model =
+        dbot::create_object_model(ori,
+                                  runtime_config.object_model_cache,
+                                  decimation,
+                                  filter_config.tracker.center_object_frame);
 
     /* ------------------------------ */
     /* - Create Filter & Tracker    - */
     /* ------------------------------ */
-    TrackerBuilder::Parameters params_tracker;
-    params_tracker.evaluation_count = params_obsrv.sample_count;
-    nh.getParam(pre + "moving_average_update_rate",
-                params_tracker.moving_average_update_rate);
-    nh.getParam(pre + "max_kl_divergence", params_tracker.max_kl_divergence);
-    nh.getParam(pre + "center_object_frame",
-                params_tracker.center_object_frame);
+    typedef dbot::ParticleTracker Tracker;
 
-    auto tracker_builder = dbot::ParticleTrackerBuilder<Tracker>(
-        state_trans_builder, sensor_builder, object_model, params_tracker);
-    auto tracker = tracker_builder.build();
+    auto build_tracker = [&](const dbot::ParticleFilterConfig& config) {
+        return dbot::create_particle_tracker(
+            config, object_model, camera_data, ori.count_meshes());
+    };
 
     dbot::ObjectTrackerRos<Tracker> ros_object_tracker(
-        tracker, camera_data, ori.count_meshes());
+        build_tracker(filter_config), camera_data, ori.count_meshes());
 
-    ros_object_tracker.tracker()->initialize({pose});
+    ros_object_tracker.initialize({pose});
 
     /* ------------------------------ */
     /* - Tracker publisher          - */
     /* ------------------------------ */
-    int object_color[3];
-    nh.getParam(pre + "object_color/R", object_color[0]);
-    nh.getParam(pre + "object_color/G", object_color[1]);
-    nh.getParam(pre + "object_color/B", object_color[2]);
-    auto tracker_publisher = dbot::ObjectStatePublisher(
-        ori, object_color[0], object_color[1], object_color[2]);
+    auto tracker_publisher =
+        dbot::ObjectStatePublisher(ori,
+                                   filter_config.object_color[0],
+                                   filter_config.object_color[1],
+                                   filter_config.object_color[2],
+                                   publisher_params);
+
+    /* ------------------------------ */
+    /* - Runtime features           - */
+    /* ------------------------------ */
+    dbot::ObjectTrackerNode<Tracker> node(nh,
+                                          ros_object_tracker,
+                                          tracker_publisher,
+                                          ori,
+                                          runtime_config,
+                                          camera_data_provider->camera_info());
+
+    // ~reinitialize rebuilds the tracker of the current request from the
+    // current filter parameters, see particle_tracker_node.cpp
+    node.reinitializable(
+        [&]() -> std::shared_ptr<Tracker> {
+            dbot::ParameterReader reader(nh);
+            dbot::ParticleFilterConfig config;
+            dbot::read(reader, "particle_filter/", config);
+            if (!reader.report()) return std::shared_ptr<Tracker>();
+            if (config.observation.use_gpu != filter_config.observation.use_gpu)
+            {
+                ROS_ERROR("Changing use_gpu requires a restart of the service");
+                return std::shared_ptr<Tracker>();
+            }
+            return build_tracker(config);
+        },
+        !filter_config.observation.use_gpu);
 
     /* ------------------------------ */
     /* - Run the tracker            - */
     /* ------------------------------ */
-    ros::Subscriber subscriber =
-        nh.subscribe(depth_image_topic,
-                     1,
-                     &dbot::ObjectTrackerRos<Tracker>::update_obsrv,
-                     &ros_object_tracker);
-    (void)subscriber;
-
     ROS_INFO_STREAM("Tracking object " << ori.mesh_without_extension(0));
-    while (ros::ok() && running)
-    {
-        usleep(1000);
-        if (ros_object_tracker.run_once())
-        {
-            tracker_publisher.publish(
-                ros_object_tracker.current_state_messages());
-        }
-    }
+    node.run(camera_config.depth_image_topic, []() { return running; });
     ROS_INFO("Tracking terminated.");
 }
 
@@ -264,8 +182,23 @@ int main(int argc, char** argv)
     ros::NodeHandle nh;
     ros::NodeHandle nh_prv("~");
 
+    dbot::ParameterReader reader(nh_prv);
     std::string service_name;
-    nh_prv.getParam("object_tracker_service_name", service_name);
+    reader.required("object_tracker_service_name", service_name);
+    dbot::read(reader, camera_config);
+    dbot::read(reader, "object/decimation/", decimation_config);
+    dbot::read(reader, "particle_filter/", filter_config);
+    dbot::read(reader, "object_state_publisher/", publisher_params);
+    dbot::read(reader, runtime_config);
+    if (!reader.report()) return 1;
+
+    // every request brings its own initial pose, hence the service never
+    // resumes from a belief checkpoint and does not write one
+    if (runtime_config.checkpoint_belief)
+    {
+        ROS_WARN("The tracker service does not write belief checkpoints");
+        runtime_config.checkpoint_belief = false;
+    }
 
     auto srv = nh.advertiseService(service_name, run_object_tracker_srv);
 
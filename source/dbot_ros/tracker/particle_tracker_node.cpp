@@ -24,13 +24,18 @@
 #include <dbot/pose/free_floating_rigid_bodies_state.h>
 #include <dbot/simple_wavefront_object_loader.h>
 #include <dbot/tracker/particle_tracker.h>
+#include <dbot_ros/object_tracker_node.h>
 #include <dbot_ros/object_tracker_publisher.h>
 #include <dbot_ros/object_tracker_ros.h>
-#include <dbot_ros/util/interactive_marker_initializer.h>
+#include <dbot_ros/util/initial_pose_source.h>
 #include <dbot_ros/util/ros_camera_data_provider.h>
 #include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/startup_timeline.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/tracker_factory.h>
 #include <fl/util/profiling.hpp>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <ros/package.h>
 #include <ros/ros.h>
@@ -63,183 +68,126 @@ int main(int argc, char** argv)
     // parameter shorthand prefix
     std::string pre = "particle_filter/";
 
-
-    /* ------------------------------ */
-    /* - Create the object model    - */
     /* ------------------------------ */
-    // get object parameters
-    std::string object_package;
-    std::string object_directory;
-    std::vector<std::string> object_meshes;
-
-    /// \todo nh.getParam does not check whether the parameter exists in the
-    /// config file. this is dangerous, we should use ri::read instead
-
-    nh.getParam("object/meshes", object_meshes);
-    nh.getParam("object/package", object_package);
-    nh.getParam("object/directory", object_directory);
-
-    // Use the ORI to load the object model usign the
-    // SimpleWavefrontObjectLoader
-    dbot::ObjectResourceIdentifier ori;
-    ori.package_path(ros::package::getPath(object_package));
-    ori.directory(object_directory);
-    ori.meshes(object_meshes);
-
-    auto object_model_loader = std::shared_ptr<dbot::ObjectModelLoader>(
-        new dbot::SimpleWavefrontObjectModelLoader(ori));
-
-    // Load the model usign the simple wavefront load and center the frames
-    // of all object part meshes
-    bool center_object_frame;
-    nh.getParam(pre + "center_object_frame", center_object_frame);
-    auto object_model = std::make_shared<dbot::ObjectModel>(
-        object_model_loader, center_object_frame);
+    /* - Configuration              - */
+    /* ------------------------------ */
+    // read and validated once, all missing or mistyped parameters are
+    // reported together
+    dbot::ParameterReader reader(nh);
+    dbot::CameraConfig camera_config;
+    dbot::ObjectConfig object_config;
+    dbot::MeshDecimationConfig decimation_config;
+    dbot::ParticleFilterConfig filter_config;
+    dbot::ObjectStatePublisher::Parameters publisher_params;
+    dbot::RuntimeConfig runtime_config;
+    dbot::read(reader, camera_config);
+    dbot::read(reader, "object/", object_config);
+    dbot::read(reader, "object/decimation/", decimation_config);
+    dbot::read(reader, pre, filter_config);
+    dbot::read(reader, "object_state_publisher/", publisher_params);
+    dbot::read(reader, runtime_config);
+    if (!reader.report()) return 1;
+
+    // The camera info wait, the object model loading and the interactive
+    // initialization run concurrently. Only the tracker build waits for the
+    // camera data and the model, and only the tracker initialization waits
+    // for the initial poses
+    dbot::StartupTimeline startup;
 
     /* ------------------------------ */
     /* - Setup camera data          - */
     /* ------------------------------ */
-    int downsampling_factor;
-    std::string camera_info_topic;
-    std::string depth_image_topic;
-    dbot::CameraData::Resolution resolution;
-    nh.getParam("camera_info_topic", camera_info_topic);
-    nh.getParam("depth_image_topic", depth_image_topic);
-    nh.getParam("downsampling_factor", downsampling_factor);
-    nh.getParam("resolution/width", resolution.width);
-    nh.getParam("resolution/height", resolution.height);
-
-    auto camera_data_provider = std::shared_ptr<dbot::CameraDataProvider>(
+    auto camera_data_provider = std::shared_ptr<dbot::RosCameraDataProvider>(
         new dbot::RosCameraDataProvider(nh,
-                                        camera_info_topic,
-                                        depth_image_topic,
-                                        resolution,
-                                        downsampling_factor,
+                                        camera_config.camera_info_topic,
+                                        camera_config.depth_image_topic,
+                                        camera_config.resolution,
+                                        camera_config.downsampling_factor,
                                         60.0));
     // Create camera data from the RosCameraDataProvider which takes the data
-    // from a ros camera topic
-    auto camera_data = std::make_shared<dbot::CameraData>(camera_data_provider);
+    // from a ros camera topic. This waits for the camera info
+    std::shared_future<std::shared_ptr<dbot::CameraData>> camera_data_task =
+        std::async(std::launch::async, [camera_data_provider, &startup]() {
+            auto camera_data =
+                std::make_shared<dbot::CameraData>(camera_data_provider);
+            startup.done("camera info");
+            return camera_data;
+        }).share();
 
     /* ------------------------------ */
-    /* - Few types we will be using - */
-    /* ------------------------------ */
-    typedef dbot::FreeFloatingRigidBodiesState<> State;
-    typedef dbot::ParticleTracker Tracker;
-    typedef dbot::ParticleTrackerBuilder<Tracker> TrackerBuilder;
-    typedef TrackerBuilder::TransitionBuilder TransitionBuilder;
-    typedef TrackerBuilder::SensorBuilder SensorBuilder;
-
-
-    /* ------------------------------ */
-    /* - State transition function  - */
-    /* ------------------------------ */
-    // We will use a linear observation model built by the object transition
-    // model builder. The linear model will generate a random walk.
-    dbot::ObjectTransitionBuilder<State>::Parameters params_state;
-    // state transition parameters
-    nh.getParam(pre + "object_transition/linear_sigma_x",
-                params_state.linear_sigma_x);
-    nh.getParam(pre + "object_transition/linear_sigma_y",
-                params_state.linear_sigma_y);
-    nh.getParam(pre + "object_transition/linear_sigma_z",
-                params_state.linear_sigma_z);
-
-    nh.getParam(pre + "object_transition/angular_sigma_x",
-                params_state.angular_sigma_x);
-    nh.getParam(pre + "object_transition/angular_sigma_y",
-                params_state.angular_sigma_y);
-    nh.getParam(pre + "object_transition/angular_sigma_z",
-                params_state.angular_sigma_z);
-
-    nh.getParam(pre + "object_transition/velocity_factor",
-                params_state.velocity_factor);
-    params_state.part_count = object_meshes.size();
-
-    auto state_trans_builder = std::shared_ptr<TransitionBuilder>(
-        new dbot::ObjectTransitionBuilder<State>(params_state));
-
-    /* ------------------------------ */
-    /* - Observation model          - */
+    /* - Create the object model    - */
     /* ------------------------------ */
-    dbot::RbSensorBuilder<State>::Parameters params_obsrv;
-    nh.getParam(pre + "use_gpu", params_obsrv.use_gpu);
-
-    if (params_obsrv.use_gpu)
-    {
-        nh.getParam(pre + "gpu/sample_count", params_obsrv.sample_count);
-    }
-    else
-    {
-        nh.getParam(pre + "cpu/sample_count", params_obsrv.sample_count);
-    }
-
-    nh.getParam(pre + "observation/occlusion/p_occluded_visible",
-                params_obsrv.occlusion.p_occluded_visible);
-    nh.getParam(pre + "observation/occlusion/p_occluded_occluded",
-                params_obsrv.occlusion.p_occluded_occluded);
-    nh.getParam(pre + "observation/occlusion/initial_occlusion_prob",
-                params_obsrv.occlusion.initial_occlusion_prob);
+    // Use the ORI to load the object model usign the
+    // SimpleWavefrontObjectLoader
+    auto ori = object_config.ori();
+
+    auto object_model_task = std::async(std::launch::async, [&]() {
+        // optional level of detail, by default a depth pixel at the nearest
+        // expected object distance. Only then the model depends on the
+        // camera info
+        auto decimation = decimation_config.levels(
+            ori,
+            decimation_config.enabled
+                ? camera_data_task.get()->camera_matrix()(0, 0)
+                : 0.0);
+
+        // meshes are parsed once and loaded from the binary cache afterwards
+        auto object_model = dbot::create_object_model(
+            ori,
+            runtime_config.object_model_cache,
+            decimation,
+            filter_config.tracker.center_object_frame);
+        startup.done("object model");
+        return object_model;
+    });
+
+    /* ------------------------------ */
+    /* - Initial poses              - */
+    /* ------------------------------ */
+    // the initial pose sources are served by the spinner. The source which
+    // provided the poses is kept alive, e.g. to keep the interactive markers
+    ros::AsyncSpinner spinner(2);
+    spinner.start();
 
-    nh.getParam(pre + "observation/kinect/tail_weight",
-                params_obsrv.kinect.tail_weight);
-    nh.getParam(pre + "observation/kinect/model_sigma",
-                params_obsrv.kinect.model_sigma);
-    nh.getParam(pre + "observation/kinect/sigma_factor",
-                params_obsrv.kinect.sigma_factor);
-    params_obsrv.delta_time = 1. / 30.;
+    std::shared_ptr<dbot::InitialPoseSource> initial_pose_source;
+    auto initial_poses_task = std::async(std::launch::async, [&]() {
+        std::vector<geometry_msgs::Pose> poses;
+        initial_pose_source =
+            dbot::wait_for_initial_poses(nh,
+                                         "initial_pose/",
+                                         ori,
+                                         camera_data_task.get()->frame_id(),
+                                         poses);
+        if (initial_pose_source) startup.done("initial poses");
+        return poses;
+    });
 
-    // gpu only parameters
-    nh.getParam(pre + "gpu/use_custom_shaders",
-                params_obsrv.use_custom_shaders);
-    nh.getParam(pre + "gpu/vertex_shader_file",
-                params_obsrv.vertex_shader_file);
-    nh.getParam(pre + "gpu/fragment_shader_file",
-                params_obsrv.fragment_shader_file);
-    nh.getParam(pre + "gpu/geometry_shader_file",
-                params_obsrv.geometry_shader_file);
+    typedef dbot::ParticleTracker Tracker;
 
-    auto sensor_builder =
-        std::shared_ptr<SensorBuilder>(new dbot::RbSensorBuilder<State>(
-            object_model, camera_data, params_obsrv));
+    // the tracker is built on the main thread which runs it later on
+    auto camera_data  = camera_data_task.get();
+    auto object_model = object_model_task.get();
 
-    /* ------------------------------ */
-    /* - Create Filter & Tracker    - */
-    /* ------------------------------ */
-    TrackerBuilder::Parameters params_tracker;
-    params_tracker.evaluation_count = params_obsrv.sample_count;
-    nh.getParam(pre + "moving_average_update_rate",
-                params_tracker.moving_average_update_rate);
-    nh.getParam(pre + "max_kl_divergence", params_tracker.max_kl_divergence);
-    nh.getParam(pre + "center_object_frame",
-                params_tracker.center_object_frame);
+    // builds the tracker from the filter configuration at startup and when
+    // the parameters are reloaded
+    auto build_tracker = [&](const dbot::ParticleFilterConfig& config) {
+        return dbot::create_particle_tracker(
+            config, object_model, camera_data, ori.count_meshes());
+    };
 
-    auto tracker_builder = dbot::ParticleTrackerBuilder<Tracker>(
-        state_trans_builder, sensor_builder, object_model, params_tracker);
-    auto tracker = tracker_builder.build();
+    auto tracker = build_tracker(filter_config);
+    startup.done("tracker build");
 
     dbot::ObjectTrackerRos<Tracker> ros_object_tracker(
         tracker, camera_data, ori.count_meshes());
 
-    /* ------------------------------ */
-    /* - Initialize interactively   - */
-    /* ------------------------------ */
-    bool use_cached_poses = false;
-    nh.getParam("use_cached_poses", use_cached_poses);
-    opi::InteractiveMarkerInitializer object_initializer(
-        camera_data->frame_id(),
-        ori.package(),
-        ori.directory(),
-        ori.meshes(),
-        {},
-        true,
-        use_cached_poses);
-    if (!object_initializer.wait_for_object_poses())
+    auto initial_ros_poses = initial_poses_task.get();
+    if (!initial_pose_source)
     {
-        ROS_INFO("Setting object poses was interrupted.");
+        ROS_INFO("No initial object poses available.");
         return 0;
     }
 
-    auto initial_ros_poses = object_initializer.poses();
     std::vector<Tracker::State> initial_poses;
     initial_poses.push_back(Tracker::State(ori.count_meshes()));
     int i = 0;
@@ -248,40 +196,53 @@ int main(int argc, char** argv)
         initial_poses[0].component(i++) = ri::to_pose_velocity_vector(ros_pose);
     }
 
-
-    tracker->initialize(initial_poses);
+    ros_object_tracker.initialize(initial_poses);
 
     /* ------------------------------ */
     /* - Tracker publisher          - */
     /* ------------------------------ */
-    int object_color[3];
-    nh.getParam(pre + "object_color/R", object_color[0]);
-    nh.getParam(pre + "object_color/G", object_color[1]);
-    nh.getParam(pre + "object_color/B", object_color[2]);
-    auto tracker_publisher = dbot::ObjectStatePublisher(
-        ori, object_color[0], object_color[1], object_color[2]);
+    auto tracker_publisher =
+        dbot::ObjectStatePublisher(ori,
+                                   filter_config.object_color[0],
+                                   filter_config.object_color[1],
+                                   filter_config.object_color[2],
+                                   publisher_params);
+
+    /* ------------------------------ */
+    /* - Runtime features           - */
+    /* ------------------------------ */
+    dbot::ObjectTrackerNode<Tracker> node(nh,
+                                          ros_object_tracker,
+                                          tracker_publisher,
+                                          ori,
+                                          runtime_config,
+                                          camera_data_provider->camera_info());
+    node.startup_timeline(startup);
+
+    // ~reinitialize rebuilds the tracker from the current filter parameters
+    // and initializes it at the current estimate. The particle set is not
+    // carried over since ParticleTracker does not expose it. The GPU
+    // observation model owns the OpenGL context of the thread it is built
+    // on, hence it is rebuilt on the tracking thread.
+    node.reinitializable(
+        [&]() -> std::shared_ptr<Tracker> {
+            dbot::ParameterReader reader(nh);
+            dbot::ParticleFilterConfig config;
+            dbot::read(reader, pre, config);
+            if (!reader.report()) return std::shared_ptr<Tracker>();
+            if (config.observation.use_gpu != filter_config.observation.use_gpu)
+            {
+                ROS_ERROR("Changing use_gpu requires a restart of the tracker");
+                return std::shared_ptr<Tracker>();
+            }
+            return build_tracker(config);
+        },
+        !filter_config.observation.use_gpu);
 
     /* ------------------------------ */
     /* - Run the tracker            - */
     /* ------------------------------ */
-    ros::Subscriber subscriber =
-        nh.subscribe(depth_image_topic,
-                     1,
-                     &dbot::ObjectTrackerRos<Tracker>::update_obsrv,
-                     &ros_object_tracker);
-    (void)subscriber;
-
-    ros::AsyncSpinner spinner(2);
-    spinner.start();
-
-    while (ros::ok())
-    {
-        if (ros_object_tracker.run_once())
-        {
-            tracker_publisher.publish(
-                ros_object_tracker.current_state_messages());
-        }
-    }
+    node.run(camera_config.depth_image_topic);
 
     return 0;
 }
@@ -0,0 +1,283 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file belief_checkpoint.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <dbot_ros/util/belief_checkpoint.h>
+#include <fcntl.h>
+#include <fstream>
+#include <ros/ros.h>
+#include <unistd.h>
+
+namespace dbot
+{
+namespace
+{
+/**
+ * \brief Layout of a checkpoint. The header is followed by the object key,
+ * padded to 8 bytes, and 13 doubles per object: position, orientation (w, x,
+ * y, z), linear and angular velocity.
+ */
+struct CheckpointHeader
+{
+    static constexpr uint32_t magic_number = 0x44424243;  // "DBBC"
+    static constexpr uint32_t version      = 2;
+
+    uint32_t magic;
+    uint32_t layout_version;
+    int64_t stamp;  ///< [ns] of the image the estimates are based on
+    uint32_t object_count;
+    uint32_t key_length;
+};
+
+const size_t values_per_object = 13;
+
+size_t padded(size_t size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+/**
+ * \brief Identifies the tracked objects by the package path, the directory
+ * and the mesh names, each terminated by a newline
+ */
+std::string object_key(const ObjectResourceIdentifier& ori)
+{
+    std::string key = ori.package_path() + "\n" + ori.directory() + "\n";
+    for (int i = 0; i < ori.count_meshes(); i++) key += ori.mesh(i) + "\n";
+    return key;
+}
+
+bool write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+}
+
+BeliefCheckpoint::BeliefCheckpoint(const ObjectResourceIdentifier& ori,
+                                   const Parameters& params)
+    : params_(params),
+      key_(object_key(ori)),
+      object_count_(ori.count_meshes()),
+      stop_(false),
+      updated_(false)
+{
+    thread_ = std::thread(&BeliefCheckpoint::run, this);
+}
+
+BeliefCheckpoint::~BeliefCheckpoint()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    stop_condition_.notify_all();
+    thread_.join();
+}
+
+void BeliefCheckpoint::update(
+    const std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_  = states;
+    updated_ = true;
+}
+
+void BeliefCheckpoint::run()
+{
+    typedef std::chrono::steady_clock Clock;
+
+    auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / params_.rate));
+    auto next = Clock::now();
+
+    std::vector<dbot_ros_msgs::ObjectState> states;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        next = std::max(next + period, Clock::now());
+        bool stop =
+            stop_condition_.wait_until(lock, next, [this]() { return stop_; });
+
+        // the latest estimates are written on shutdown as well
+        if (updated_)
+        {
+            states.swap(states_);
+            updated_ = false;
+
+            lock.unlock();
+            write(states);
+            lock.lock();
+        }
+
+        if (stop) break;
+    }
+}
+
+void BeliefCheckpoint::write(
+    const std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    if (states.size() != object_count_) return;
+
+    CheckpointHeader header;
+    header.magic          = CheckpointHeader::magic_number;
+    header.layout_version = CheckpointHeader::version;
+    header.stamp          = states[0].pose.header.stamp.toNSec();
+    header.object_count   = states.size();
+    header.key_length     = key_.size();
+
+    std::vector<double> values;
+    values.reserve(values_per_object * states.size());
+    for (auto& state : states)
+    {
+        auto& pose     = state.pose.pose;
+        auto& velocity = state.velocity.twist;
+        values.insert(values.end(),
+                      {pose.position.x,
+                       pose.position.y,
+                       pose.position.z,
+                       pose.orientation.w,
+                       pose.orientation.x,
+                       pose.orientation.y,
+                       pose.orientation.z,
+                       velocity.linear.x,
+                       velocity.linear.y,
+                       velocity.linear.z,
+                       velocity.angular.x,
+                       velocity.angular.y,
+                       velocity.angular.z});
+    }
+
+    std::string data(reinterpret_cast<const char*>(&header), sizeof(header));
+    data += key_;
+    data.resize(data.size() + padded(key_.size()) - key_.size(), '\0');
+    data.append(reinterpret_cast<const char*>(values.data()),
+                sizeof(double) * values.size());
+
+    // written to a process specific file first, synced and renamed, such
+    // that neither a crash nor a power loss leaves a partial checkpoint
+    // behind
+    auto temporary_path = params_.path + "." + std::to_string(getpid());
+    int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    bool written = fd >= 0 && write_all(fd, data.data(), data.size()) &&
+                   fsync(fd) == 0;
+    if (fd >= 0 && close(fd) != 0) written = false;
+
+    if (!written ||
+        std::rename(temporary_path.c_str(), params_.path.c_str()) != 0)
+    {
+        ROS_WARN_THROTTLE(
+            10.0, "Cannot write belief checkpoint %s", params_.path.c_str());
+        std::remove(temporary_path.c_str());
+    }
+}
+
+bool BeliefCheckpoint::load(const ObjectResourceIdentifier& ori,
+                            const Parameters& params,
+                            std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    std::ifstream file(params.path, std::ios::binary);
+    if (!file) return false;
+
+    CheckpointHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != CheckpointHeader::magic_number ||
+        header.layout_version != CheckpointHeader::version)
+    {
+        ROS_WARN("Ignoring invalid belief checkpoint %s", params.path.c_str());
+        return false;
+    }
+
+    auto expected_key = object_key(ori);
+    std::string key(padded(header.key_length), '\0');
+    if (header.key_length == expected_key.size())
+    {
+        file.read(&key[0], key.size());
+        key.resize(header.key_length);
+    }
+
+    if (!file || header.object_count != uint32_t(ori.count_meshes()) ||
+        key != expected_key)
+    {
+        ROS_WARN("Ignoring belief checkpoint %s of other objects",
+                 params.path.c_str());
+        return false;
+    }
+
+    ros::Time stamp;
+    stamp.fromNSec(header.stamp);
+    double age = (ros::Time::now() - stamp).toSec();
+    if (params.max_age > 0.0 && age > params.max_age)
+    {
+        ROS_INFO("Ignoring belief checkpoint %s, it is %.1f s old",
+                 params.path.c_str(),
+                 age);
+        return false;
+    }
+
+    std::vector<double> values(values_per_object * header.object_count);
+    file.read(reinterpret_cast<char*>(values.data()),
+              sizeof(double) * values.size());
+    if (!file)
+    {
+        ROS_WARN("Ignoring truncated belief checkpoint %s",
+                 params.path.c_str());
+        return false;
+    }
+
+    states.resize(header.object_count);
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        const double* value = &values[values_per_object * i];
+        auto& pose          = states[i].pose.pose;
+        auto& velocity      = states[i].velocity.twist;
+
+        states[i].pose.header.stamp     = stamp;
+        states[i].velocity.header.stamp = stamp;
+
+        pose.position.x    = value[0];
+        pose.position.y    = value[1];
+        pose.position.z    = value[2];
+        pose.orientation.w = value[3];
+        pose.orientation.x = value[4];
+        pose.orientation.y = value[5];
+        pose.orientation.z = value[6];
+        velocity.linear.x  = value[7];
+        velocity.linear.y  = value[8];
+        velocity.linear.z  = value[9];
+        velocity.angular.x = value[10];
+        velocity.angular.y = value[11];
+        velocity.angular.z = value[12];
+    }
+
+    ROS_INFO("Resuming from belief checkpoint %s of %.1f s ago",
+             params.path.c_str(),
+             age);
+    return true;
+}
+}
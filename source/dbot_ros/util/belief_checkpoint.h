@@ -0,0 +1,86 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file belief_checkpoint.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/util/runtime_parameters.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Periodically writes the latest object state estimates into a
+ * compact binary checkpoint, such that a restarted tracker resumes from them
+ * instead of being initialized again.
+ *
+ * The checkpoint is written from a dedicated thread into a temporary file
+ * which is synced and renamed afterwards, i.e. a crash during writing leaves
+ * the previous checkpoint intact. It is only resumed from by trackers of the
+ * same objects, i.e. of the same package path, directory and meshes.
+ */
+class BeliefCheckpoint
+{
+public:
+    typedef BeliefCheckpointParameters Parameters;
+
+public:
+    BeliefCheckpoint(const ObjectResourceIdentifier& ori,
+                     const Parameters& params = Parameters());
+
+    /**
+     * \brief Writes the latest estimates and stops the checkpoint thread
+     */
+    ~BeliefCheckpoint();
+
+    /**
+     * \brief Sets the estimates written with the next checkpoint
+     */
+    void update(const std::vector<dbot_ros_msgs::ObjectState>& states);
+
+    /**
+     * \brief Loads the object states of the checkpoint at \c params.path
+     * \return false if there is no checkpoint, it is too old or it was
+     *         written for other objects than \c ori
+     */
+    static bool load(const ObjectResourceIdentifier& ori,
+                     const Parameters& params,
+                     std::vector<dbot_ros_msgs::ObjectState>& states);
+
+private:
+    void run();
+    void write(const std::vector<dbot_ros_msgs::ObjectState>& states);
+
+private:
+    Parameters params_;
+    std::string key_;
+    size_t object_count_;
+
+    std::mutex mutex_;
+    std::condition_variable stop_condition_;
+    bool stop_;
+    bool updated_;
+    std::vector<dbot_ros_msgs::ObjectState> states_;
+
+    std::thread thread_;
+};
+}
@@ -0,0 +1,311 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file cached_object_model_loader.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dbot/simple_wavefront_object_loader.h>
+#include <dbot_ros/util/cached_object_model_loader.h>
+#include <fstream>
+#include <functional>
+#include <ros/ros.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dbot
+{
+namespace
+{
+/**
+ * \brief Layout of a cache entry. The header is followed by the entry key
+ * padded to 8 bytes, the vertices as 3 doubles each and the triangles as 3
+ * 32 bit indices each.
+ */
+struct EntryHeader
+{
+    static constexpr uint32_t magic_number = 0x44424d43;  // "DBMC"
+    static constexpr uint32_t version      = 1;
+
+    uint32_t magic;
+    uint32_t layout_version;
+    int64_t mesh_mtime;  ///< [ns]
+    uint64_t mesh_size;
+    uint32_t key_length;
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    uint32_t padding;
+};
+
+size_t padded(size_t size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+size_t entry_size(const EntryHeader& header)
+{
+    return sizeof(EntryHeader) + padded(header.key_length) +
+           sizeof(double) * 3 * header.vertex_count +
+           sizeof(int32_t) * 3 * header.triangle_count;
+}
+
+bool mesh_status(const std::string& mesh_path, int64_t& mtime, uint64_t& size)
+{
+    struct stat status;
+    if (stat(mesh_path.c_str(), &status) != 0) return false;
+
+    mtime = int64_t(status.st_mtim.tv_sec) * 1000000000 +
+            status.st_mtim.tv_nsec;
+    size = status.st_size;
+    return true;
+}
+}
+
+CachedObjectModelLoader::CachedObjectModelLoader(
+    const ObjectResourceIdentifier& ori,
+    const std::string& cache_directory,
+    const std::vector<MeshDecimation>& decimation)
+    : ori_(ori),
+      cache_directory_(cache_directory.empty() ? default_cache_directory()
+                                               : cache_directory),
+      decimation_(decimation)
+{
+}
+
+void CachedObjectModelLoader::load(
+    std::vector<std::vector<Eigen::Vector3d>>& vertices,
+    std::vector<std::vector<std::vector<int>>>& triangle_indices) const
+{
+    vertices.resize(ori_.count_meshes());
+    triangle_indices.resize(ori_.count_meshes());
+
+    for (int i = 0; i < ori_.count_meshes(); i++)
+    {
+        if (size_t(i) >= decimation_.size() || !decimation_[i].enabled())
+        {
+            load_mesh(i, vertices[i], triangle_indices[i]);
+            continue;
+        }
+
+        auto mesh_path = ori_.mesh_path(i);
+        char parameters[64];
+        std::snprintf(parameters,
+                      sizeof(parameters),
+                      "?tolerance=%g&max_triangles=%d",
+                      decimation_[i].tolerance,
+                      decimation_[i].max_triangles);
+        auto key = mesh_path + parameters;
+        if (read_entry(mesh_path, key, vertices[i], triangle_indices[i]))
+        {
+            continue;
+        }
+
+        load_mesh(i, vertices[i], triangle_indices[i]);
+        size_t triangle_count = triangle_indices[i].size();
+        decimate_mesh(decimation_[i], vertices[i], triangle_indices[i]);
+        ROS_INFO("Decimated %s from %zu to %zu triangles",
+                 ori_.mesh(i).c_str(),
+                 triangle_count,
+                 triangle_indices[i].size());
+
+        write_entry(mesh_path, key, vertices[i], triangle_indices[i]);
+    }
+}
+
+std::string CachedObjectModelLoader::default_cache_directory()
+{
+    const char* ros_home = std::getenv("ROS_HOME");
+    if (ros_home) return std::string(ros_home) + "/dbot_mesh_cache";
+
+    const char* home = std::getenv("HOME");
+    return std::string(home ? home : ".") + "/.ros/dbot_mesh_cache";
+}
+
+void CachedObjectModelLoader::load_mesh(
+    int index,
+    std::vector<Eigen::Vector3d>& vertices,
+    std::vector<std::vector<int>>& triangle_indices) const
+{
+    auto mesh_path = ori_.mesh_path(index);
+    if (read_entry(mesh_path, mesh_path, vertices, triangle_indices)) return;
+
+    ObjectResourceIdentifier mesh_ori;
+    mesh_ori.package_path(ori_.package_path());
+    mesh_ori.directory(ori_.directory());
+    mesh_ori.meshes({ori_.mesh(index)});
+
+    std::vector<std::vector<Eigen::Vector3d>> mesh_vertices;
+    std::vector<std::vector<std::vector<int>>> mesh_triangle_indices;
+    SimpleWavefrontObjectModelLoader(mesh_ori)
+        .load(mesh_vertices, mesh_triangle_indices);
+    vertices.swap(mesh_vertices[0]);
+    triangle_indices.swap(mesh_triangle_indices[0]);
+
+    write_entry(mesh_path, mesh_path, vertices, triangle_indices);
+}
+
+std::string CachedObjectModelLoader::entry_path(const std::string& key) const
+{
+    char name[32];
+    std::snprintf(name,
+                  sizeof(name),
+                  "%016llx.mesh",
+                  (unsigned long long)std::hash<std::string>()(key));
+
+    return cache_directory_ + "/" + name;
+}
+
+bool CachedObjectModelLoader::read_entry(
+    const std::string& mesh_path,
+    const std::string& key,
+    std::vector<Eigen::Vector3d>& vertices,
+    std::vector<std::vector<int>>& triangle_indices) const
+{
+    int64_t mesh_mtime;
+    uint64_t mesh_size;
+    if (!mesh_status(mesh_path, mesh_mtime, mesh_size)) return false;
+
+    std::ifstream file(entry_path(key), std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    size_t size = file.tellg();
+    if (size < sizeof(EntryHeader)) return false;
+
+    // the entry is converted into the vectors ObjectModel keeps, i.e. it is
+    // read at once and not kept in memory
+    std::vector<char> buffer(size);
+    file.seekg(0);
+    if (!file.read(buffer.data(), size)) return false;
+
+    const char* data = buffer.data();
+    EntryHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    // stale entries are replaced by the caller
+    bool valid = header.magic == EntryHeader::magic_number &&
+                 header.layout_version == EntryHeader::version &&
+                 header.mesh_mtime == mesh_mtime &&
+                 header.mesh_size == mesh_size &&
+                 header.key_length == key.size() &&
+                 entry_size(header) == size &&
+                 key.compare(0,
+                             std::string::npos,
+                             data + sizeof(header),
+                             header.key_length) == 0;
+
+    if (valid)
+    {
+        const double* coordinates = reinterpret_cast<const double*>(
+            data + sizeof(header) + padded(header.key_length));
+        const int32_t* indices = reinterpret_cast<const int32_t*>(
+            coordinates + 3 * header.vertex_count);
+
+        vertices.resize(header.vertex_count);
+        for (uint32_t i = 0; i < header.vertex_count; ++i)
+        {
+            vertices[i] = Eigen::Vector3d(coordinates[3 * i],
+                                          coordinates[3 * i + 1],
+                                          coordinates[3 * i + 2]);
+        }
+
+        triangle_indices.resize(header.triangle_count);
+        for (uint32_t i = 0; i < header.triangle_count; ++i)
+        {
+            triangle_indices[i].assign(indices + 3 * i, indices + 3 * i + 3);
+        }
+    }
+
+    return valid;
+}
+
+void CachedObjectModelLoader::write_entry(
+    const std::string& mesh_path,
+    const std::string& key,
+    const std::vector<Eigen::Vector3d>& vertices,
+    const std::vector<std::vector<int>>& triangle_indices) const
+{
+    EntryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    if (!mesh_status(mesh_path, header.mesh_mtime, header.mesh_size)) return;
+
+    for (auto& triangle : triangle_indices)
+    {
+        if (triangle.size() != 3)
+        {
+            ROS_WARN("Mesh %s is not triangulated and will not be cached",
+                     mesh_path.c_str());
+            return;
+        }
+    }
+
+    header.magic          = EntryHeader::magic_number;
+    header.layout_version = EntryHeader::version;
+    header.key_length     = key.size();
+    header.vertex_count   = vertices.size();
+    header.triangle_count = triangle_indices.size();
+
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * vertices.size());
+    for (auto& vertex : vertices)
+    {
+        coordinates.insert(coordinates.end(), vertex.data(), vertex.data() + 3);
+    }
+
+    std::vector<int32_t> indices;
+    indices.reserve(3 * triangle_indices.size());
+    for (auto& triangle : triangle_indices)
+    {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+
+    // written to a process specific file first and renamed, such that
+    // concurrent readers never map a partial entry
+    auto path           = entry_path(key);
+    auto temporary_path = path + "." + std::to_string(getpid());
+    try
+    {
+        boost::filesystem::create_directories(cache_directory_);
+
+        std::ofstream file(temporary_path, std::ios::binary);
+        const char padding[8] = {0};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(key.data(), key.size());
+        file.write(padding, padded(key.size()) - key.size());
+        file.write(reinterpret_cast<const char*>(coordinates.data()),
+                   sizeof(double) * coordinates.size());
+        file.write(reinterpret_cast<const char*>(indices.data()),
+                   sizeof(int32_t) * indices.size());
+        file.close();
+
+        if (!file)
+        {
+            ROS_WARN("Cannot write mesh cache entry %s",
+                     temporary_path.c_str());
+            std::remove(temporary_path.c_str());
+            return;
+        }
+
+        boost::filesystem::rename(temporary_path, path);
+    }
+    catch (std::exception& e)
+    {
+        ROS_WARN("Cannot cache mesh %s: %s", mesh_path.c_str(), e.what());
+        std::remove(temporary_path.c_str());
+    }
+}
+}
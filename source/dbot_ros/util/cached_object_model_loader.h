@@ -0,0 +1,105 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file cached_object_model_loader.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <dbot/object_model_loader.h>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/util/mesh_decimation.h>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Loads the object meshes from a binary cache and parses the
+ * Wavefront files only on a cache miss.
+ *
+ * Each mesh is cached in its own file holding the vertices and triangle
+ * indices in the layout they are loaded into. An entry is keyed by the mesh
+ * path and valid as long as the modification time and size of the mesh file
+ * are unchanged. Entries are written through a rename such that concurrent
+ * processes never observe partial entries.
+ *
+ * The cache is a parse cache. ObjectModelLoader hands the model to
+ * ObjectModel as vectors of vertices and triangles, hence an entry is read
+ * into these and each tracker holds its own copy of the model. Loading an
+ * entry saves parsing the mesh file, not memory.
+ *
+ * Meshes may be decimated to a coarser level of detail. The decimated mesh
+ * is cached in a separate entry keyed by the decimation parameters and built
+ * from the full resolution entry.
+ *
+ * Centering of the object frames remains with ObjectModel, which computes
+ * it from the loaded, possibly decimated, vertices.
+ */
+class CachedObjectModelLoader : public ObjectModelLoader
+{
+public:
+    /**
+     * \param cache_directory   Directory of the cache entries, created if
+     *                          missing. If empty, default_cache_directory()
+     *                          is used.
+     * \param decimation        Level of detail per mesh. Meshes without
+     *                          entry are loaded at full resolution.
+     */
+    CachedObjectModelLoader(
+        const ObjectResourceIdentifier& ori,
+        const std::string& cache_directory = "",
+        const std::vector<MeshDecimation>& decimation =
+            std::vector<MeshDecimation>());
+
+    void load(std::vector<std::vector<Eigen::Vector3d>>& vertices,
+              std::vector<std::vector<std::vector<int>>>& triangle_indices)
+        const;
+
+    /**
+     * \brief $ROS_HOME/dbot_mesh_cache, defaults to ~/.ros/dbot_mesh_cache
+     */
+    static std::string default_cache_directory();
+
+private:
+    /**
+     * \brief Loads the full resolution mesh from the cache or the mesh file
+     */
+    void load_mesh(int index,
+                   std::vector<Eigen::Vector3d>& vertices,
+                   std::vector<std::vector<int>>& triangle_indices) const;
+
+    std::string entry_path(const std::string& key) const;
+
+    /**
+     * \param key   identifies the entry, i.e. the mesh path followed by the
+     *              decimation parameters for decimated meshes
+     */
+    bool read_entry(const std::string& mesh_path,
+                    const std::string& key,
+                    std::vector<Eigen::Vector3d>& vertices,
+                    std::vector<std::vector<int>>& triangle_indices) const;
+
+    void write_entry(
+        const std::string& mesh_path,
+        const std::string& key,
+        const std::vector<Eigen::Vector3d>& vertices,
+        const std::vector<std::vector<int>>& triangle_indices) const;
+
+private:
+    ObjectResourceIdentifier ori_;
+    std::string cache_directory_;
+    std::vector<MeshDecimation> decimation_;
+};
+}
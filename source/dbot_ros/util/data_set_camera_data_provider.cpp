@@ -26,16 +26,46 @@ namespace dbot
 {
 DataSetCameraDataProvider::DataSetCameraDataProvider(
     const std::shared_ptr<TrackingDataset> data_set, int downsampling_factor)
-    : data_set_(data_set), downsampling_factor_(downsampling_factor)
+    : data_set_(data_set), downsampling_factor_(downsampling_factor), frame_(0)
 {
-    auto ros_image            = data_set_->GetImage(0);
-    native_resolution_.height = ros_image->height;
-    native_resolution_.width  = ros_image->width;
+    // the images of a dataset may be read only on demand
+    auto info                 = data_set_->GetInfo(0);
+    native_resolution_.height = info->height;
+    native_resolution_.width  = info->width;
+}
+
+void DataSetCameraDataProvider::frame(size_t index)
+{
+    frame_ = index;
+}
+
+size_t DataSetCameraDataProvider::frame() const
+{
+    return frame_;
+}
+
+bool DataSetCameraDataProvider::next_frame()
+{
+    if (frame_ + 1 >= data_set_->Size()) return false;
+
+    ++frame_;
+    return true;
+}
+
+size_t DataSetCameraDataProvider::frame_count() const
+{
+    return data_set_->Size();
 }
 
 Eigen::MatrixXd DataSetCameraDataProvider::depth_image() const
 {
-    auto ros_image = data_set_->GetImage(0);
+    // reads the image from the bag if the dataset has been loaded without
+    auto ros_image = data_set_->ReadImages({frame_}).front();
+    if (!ros_image)
+    {
+        ROS_ERROR("Frame %zu has no depth image", frame_);
+        return Eigen::MatrixXd();
+    }
 
     auto image = ri::to_eigen_matrix<double>(*ros_image, downsampling_factor_);
 
@@ -44,7 +74,13 @@ Eigen::MatrixXd DataSetCameraDataProvider::depth_image() const
 
 Eigen::VectorXd DataSetCameraDataProvider::depth_image_vector() const
 {
-    auto ros_image = data_set_->GetImage(0);
+    // reads the image from the bag if the dataset has been loaded without
+    auto ros_image = data_set_->ReadImages({frame_}).front();
+    if (!ros_image)
+    {
+        ROS_ERROR("Frame %zu has no depth image", frame_);
+        return Eigen::VectorXd();
+    }
 
     auto image = ri::to_eigen_vector<double>(*ros_image, downsampling_factor_);
 
@@ -46,13 +46,33 @@ public:
 
 public:
     /**
-     * \brief returns an obtained depth image as an Eigen matrix from depth
-     *        image topic
+     * \brief Moves the frame cursor to the dataset frame \c index
+     */
+    void frame(size_t index);
+
+    /**
+     * \brief Returns the dataset frame index the cursor points to
+     */
+    size_t frame() const;
+
+    /**
+     * \brief Advances the frame cursor
+     * \return false if the cursor already points to the last frame
+     */
+    bool next_frame();
+
+    /**
+     * \brief Number of frames within the dataset
+     */
+    size_t frame_count() const;
+
+    /**
+     * \brief returns the depth image of the current frame as an Eigen matrix
      */
     Eigen::MatrixXd depth_image() const;
 
     /**
-     * \brief returns an obtained depth image as an Eigen vector
+     * \brief returns the depth image of the current frame as an Eigen vector
      */
     Eigen::VectorXd depth_image_vector() const;
 
@@ -82,5 +102,6 @@ private:
     std::shared_ptr<TrackingDataset> data_set_;
     CameraData::Resolution native_resolution_;
     int downsampling_factor_;
+    size_t frame_;
 };
 }
@@ -0,0 +1,195 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file depth_rasterizer.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <dbot_ros/util/depth_rasterizer.h>
+#include <limits>
+
+namespace dbot
+{
+// geometry closer to the camera than this is not rendered
+static const double near_plane = 1e-3;
+
+DepthRasterizer::DepthRasterizer(const Eigen::Matrix3d& camera_matrix,
+                                 int width,
+                                 int height)
+    : camera_matrix_(camera_matrix),
+      width_(width),
+      height_(height),
+      depth_(width * height, std::numeric_limits<float>::infinity())
+{
+}
+
+void DepthRasterizer::clear()
+{
+    std::fill(
+        depth_.begin(), depth_.end(), std::numeric_limits<float>::infinity());
+}
+
+void DepthRasterizer::plane(const Eigen::Vector3d& point,
+                            const Eigen::Vector3d& normal)
+{
+    const double fx     = camera_matrix_(0, 0);
+    const double fy     = camera_matrix_(1, 1);
+    const double cx     = camera_matrix_(0, 2);
+    const double cy     = camera_matrix_(1, 2);
+    const double offset = normal.dot(point);
+
+    for (int row = 0; row < height_; ++row)
+    {
+        for (int col = 0; col < width_; ++col)
+        {
+            // the pixel ray has unit z, hence its parameter is the depth
+            Eigen::Vector3d ray((col - cx) / fx, (row - cy) / fy, 1.0);
+            double denominator = normal.dot(ray);
+            if (std::fabs(denominator) < 1e-12) continue;
+
+            double z     = offset / denominator;
+            float& depth = depth_[row * width_ + col];
+            if (z > near_plane && z < depth) depth = z;
+        }
+    }
+}
+
+void DepthRasterizer::mesh(const Vertices& vertices,
+                           const Triangles& triangles,
+                           const Eigen::Affine3d& pose)
+{
+    Vertices transformed(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        transformed[i] = pose * vertices[i];
+    }
+
+    for (auto& indices : triangles)
+    {
+        if (indices.size() < 3) continue;
+
+        triangle(transformed[indices[0]],
+                 transformed[indices[1]],
+                 transformed[indices[2]]);
+    }
+}
+
+const std::vector<float>& DepthRasterizer::depth() const
+{
+    return depth_;
+}
+
+int DepthRasterizer::width() const
+{
+    return width_;
+}
+
+int DepthRasterizer::height() const
+{
+    return height_;
+}
+
+void DepthRasterizer::box(const Eigen::Vector3d& size,
+                          Vertices& vertices,
+                          Triangles& triangles)
+{
+    Eigen::Vector3d half = size / 2.0;
+
+    vertices.clear();
+    for (int i = 0; i < 8; ++i)
+    {
+        vertices.push_back(Eigen::Vector3d(i & 1 ? half.x() : -half.x(),
+                                           i & 2 ? half.y() : -half.y(),
+                                           i & 4 ? half.z() : -half.z()));
+    }
+
+    // two triangles per face, faces are rendered from both sides
+    triangles = {{0, 1, 3}, {0, 3, 2}, {4, 5, 7}, {4, 7, 6},
+                 {0, 1, 5}, {0, 5, 4}, {2, 3, 7}, {2, 7, 6},
+                 {0, 2, 6}, {0, 6, 4}, {1, 3, 7}, {1, 7, 5}};
+}
+
+void DepthRasterizer::triangle(const Eigen::Vector3d& a,
+                               const Eigen::Vector3d& b,
+                               const Eigen::Vector3d& c)
+{
+    // triangles crossing the near plane are not clipped but dropped
+    if (a.z() < near_plane || b.z() < near_plane || c.z() < near_plane)
+    {
+        return;
+    }
+
+    auto project = [this](const Eigen::Vector3d& p)
+    {
+        return Eigen::Vector2d(
+            camera_matrix_(0, 0) * p.x() / p.z() + camera_matrix_(0, 2),
+            camera_matrix_(1, 1) * p.y() / p.z() + camera_matrix_(1, 2));
+    };
+
+    auto edge = [](const Eigen::Vector2d& p,
+                   const Eigen::Vector2d& q,
+                   const Eigen::Vector2d& r)
+    {
+        return (q.x() - p.x()) * (r.y() - p.y()) -
+               (q.y() - p.y()) * (r.x() - p.x());
+    };
+
+    Eigen::Vector2d pa = project(a);
+    Eigen::Vector2d pb = project(b);
+    Eigen::Vector2d pc = project(c);
+
+    double area = edge(pa, pb, pc);
+    if (std::fabs(area) < 1e-12) return;
+
+    double min_x = std::min({pa.x(), pb.x(), pc.x()});
+    double max_x = std::max({pa.x(), pb.x(), pc.x()});
+    double min_y = std::min({pa.y(), pb.y(), pc.y()});
+    double max_y = std::max({pa.y(), pb.y(), pc.y()});
+
+    // vertices close to the camera plane project far beyond the range of int,
+    // hence the bounds are clamped to the image before the conversion. An
+    // empty range remains empty, NaN yields the lower bound.
+    auto clamp = [](double value, double lower, double upper)
+    {
+        return std::max(lower, std::min(value, upper));
+    };
+
+    int min_col = int(std::ceil(clamp(min_x, 0.0, width_)));
+    int max_col = int(std::floor(clamp(max_x, -1.0, width_ - 1)));
+    int min_row = int(std::ceil(clamp(min_y, 0.0, height_)));
+    int max_row = int(std::floor(clamp(max_y, -1.0, height_ - 1)));
+
+    // depth is not linear in screen space but its inverse is
+    const double inv_za = 1.0 / a.z();
+    const double inv_zb = 1.0 / b.z();
+    const double inv_zc = 1.0 / c.z();
+
+    for (int row = min_row; row <= max_row; ++row)
+    {
+        for (int col = min_col; col <= max_col; ++col)
+        {
+            Eigen::Vector2d p(col, row);
+            double wa = edge(pb, pc, p) / area;
+            double wb = edge(pc, pa, p) / area;
+            double wc = 1.0 - wa - wb;
+            if (wa < 0.0 || wb < 0.0 || wc < 0.0) continue;
+
+            double z     = 1.0 / (wa * inv_za + wb * inv_zb + wc * inv_zc);
+            float& depth = depth_[row * width_ + col];
+            if (z < depth) depth = z;
+        }
+    }
+}
+}
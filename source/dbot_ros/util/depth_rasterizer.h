@@ -0,0 +1,91 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file depth_rasterizer.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Renders depth images of triangle meshes on the CPU using a z-buffer.
+ *
+ * All geometry is given in the camera frame, i.e. z pointing along the
+ * optical axis. Depth values are the z coordinates in meters. Pixels not
+ * covered by any geometry are infinite.
+ */
+class DepthRasterizer
+{
+public:
+    typedef std::vector<Eigen::Vector3d> Vertices;
+    typedef std::vector<std::vector<int>> Triangles;
+
+public:
+    /**
+     * \brief Creates a DepthRasterizer for a pinhole camera
+     */
+    DepthRasterizer(const Eigen::Matrix3d& camera_matrix,
+                    int width,
+                    int height);
+
+    /**
+     * \brief Resets all pixels to infinity
+     */
+    void clear();
+
+    /**
+     * \brief Renders the infinite plane through \c point with the normal
+     *        \c normal
+     */
+    void plane(const Eigen::Vector3d& point, const Eigen::Vector3d& normal);
+
+    /**
+     * \brief Renders a mesh located at \c pose
+     */
+    void mesh(const Vertices& vertices,
+              const Triangles& triangles,
+              const Eigen::Affine3d& pose);
+
+    /**
+     * \brief Row major depth image
+     */
+    const std::vector<float>& depth() const;
+
+    int width() const;
+    int height() const;
+
+    /**
+     * \brief Creates the mesh of an axis aligned box centered at the origin
+     */
+    static void box(const Eigen::Vector3d& size,
+                    Vertices& vertices,
+                    Triangles& triangles);
+
+private:
+    void triangle(const Eigen::Vector3d& a,
+                  const Eigen::Vector3d& b,
+                  const Eigen::Vector3d& c);
+
+private:
+    Eigen::Matrix3d camera_matrix_;
+    int width_;
+    int height_;
+    std::vector<float> depth_;
+};
+}
@@ -0,0 +1,252 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file flight_recorder.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <dbot_ros/util/flight_recorder.h>
+#include <dbot_ros/util/session_writer.h>
+#include <ros/ros.h>
+
+namespace dbot
+{
+FlightRecorder::FlightRecorder(const Parameters& params,
+                               const sensor_msgs::CameraInfo& camera_info,
+                               size_t object_count)
+    : params_(params),
+      camera_info_(camera_info),
+      ring_(std::max<size_t>(1, std::ceil(params.duration * params.rate))),
+      next_slot_(0),
+      frame_count_(0),
+      dropped_frames_(0),
+      dump_ring_(ring_.size()),
+      dump_requested_(false),
+      running_(true)
+{
+    // reserve enough for the largest depth encoding (32FC1) and for the
+    // states of all objects such that recording never reallocates
+    for (auto* ring : {&ring_, &dump_ring_})
+    {
+        for (auto& frame : *ring)
+        {
+            frame.image.data.reserve(camera_info.width * camera_info.height *
+                                     sizeof(float));
+            frame.states.reserve(object_count);
+        }
+    }
+
+    ROS_INFO("Flight recorder keeps the last %zu frames", ring_.size());
+
+    dump_thread_ = std::thread(&FlightRecorder::dump_loop, this);
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    {
+        std::lock_guard<std::mutex> lock(dump_mutex_);
+        running_ = false;
+    }
+    dump_condition_.notify_one();
+    if (dump_thread_.joinable()) dump_thread_.join();
+}
+
+void FlightRecorder::record(
+    const sensor_msgs::Image& image,
+    const std::vector<dbot_ros_msgs::ObjectState>& states,
+    double latency)
+{
+    {
+        // the ring is locked by the dump thread only to swap it
+        std::unique_lock<std::mutex> lock(ring_mutex_, std::try_to_lock);
+        if (lock.owns_lock())
+        {
+            // assignment reuses the buffers of the preallocated slot
+            ring_[next_slot_].image  = image;
+            ring_[next_slot_].states = states;
+            next_slot_   = (next_slot_ + 1) % ring_.size();
+            frame_count_ = std::min(frame_count_ + 1, ring_.size());
+        }
+        else
+        {
+            ++dropped_frames_;
+        }
+    }
+
+    std::string reason;
+    if (params_.max_latency > 0.0 && latency > params_.max_latency)
+    {
+        reason = "latency of " + std::to_string(latency) + " s";
+    }
+    else if (is_tracking_loss(states))
+    {
+        reason = "tracking loss";
+    }
+    previous_states_ = states;
+
+    if (reason.empty()) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (last_automatic_trigger_.time_since_epoch().count() != 0 &&
+        now - last_automatic_trigger_ <
+            std::chrono::duration<double>(params_.trigger_cooldown))
+    {
+        return;
+    }
+
+    if (trigger(reason)) last_automatic_trigger_ = now;
+}
+
+bool FlightRecorder::trigger(const std::string& reason)
+{
+    {
+        std::lock_guard<std::mutex> lock(dump_mutex_);
+        if (dump_requested_) return false;
+        dump_requested_ = true;
+        dump_reason_    = reason;
+    }
+    dump_condition_.notify_one();
+
+    return true;
+}
+
+bool FlightRecorder::trigger_srv(std_srvs::Trigger::Request& req,
+                                 std_srvs::Trigger::Response& res)
+{
+    res.success = trigger("service call");
+    res.message = res.success ? "Dumping flight recorder"
+                              : "Flight recorder dump already in progress";
+    return true;
+}
+
+size_t FlightRecorder::dropped_frames() const
+{
+    return dropped_frames_;
+}
+
+bool FlightRecorder::is_tracking_loss(
+    const std::vector<dbot_ros_msgs::ObjectState>& states) const
+{
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        auto& pose = states[i].pose.pose;
+        if (!std::isfinite(pose.position.x) ||
+            !std::isfinite(pose.position.y) ||
+            !std::isfinite(pose.position.z) ||
+            !std::isfinite(pose.orientation.w) ||
+            !std::isfinite(pose.orientation.x) ||
+            !std::isfinite(pose.orientation.y) ||
+            !std::isfinite(pose.orientation.z))
+        {
+            return true;
+        }
+
+        if (previous_states_.size() != states.size()) continue;
+
+        auto& previous_pose = previous_states_[i].pose.pose;
+
+        double dx = pose.position.x - previous_pose.position.x;
+        double dy = pose.position.y - previous_pose.position.y;
+        double dz = pose.position.z - previous_pose.position.z;
+        if (params_.max_translation_jump > 0.0 &&
+            std::sqrt(dx * dx + dy * dy + dz * dz) >
+                params_.max_translation_jump)
+        {
+            return true;
+        }
+
+        double dot = pose.orientation.w * previous_pose.orientation.w +
+                     pose.orientation.x * previous_pose.orientation.x +
+                     pose.orientation.y * previous_pose.orientation.y +
+                     pose.orientation.z * previous_pose.orientation.z;
+        double angle = 2.0 * std::acos(std::min(1.0, std::fabs(dot)));
+        if (params_.max_rotation_jump > 0.0 &&
+            angle > params_.max_rotation_jump)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FlightRecorder::dump_loop()
+{
+    std::unique_lock<std::mutex> lock(dump_mutex_);
+
+    while (true)
+    {
+        dump_condition_.wait(lock,
+                             [this]() { return dump_requested_ || !running_; });
+
+        // a pending dump is finished before terminating
+        if (!dump_requested_) break;
+
+        auto reason = dump_reason_;
+        lock.unlock();
+        dump(reason);
+        lock.lock();
+
+        dump_requested_ = false;
+    }
+}
+
+void FlightRecorder::dump(const std::string& reason)
+{
+    size_t first;
+    size_t frame_count;
+    {
+        // the recorded frames are handed to the dump by swapping the rings,
+        // recording continues into the other ring while they are written
+        std::lock_guard<std::mutex> lock(ring_mutex_);
+        ring_.swap(dump_ring_);
+        frame_count = frame_count_;
+        first       = (next_slot_ + ring_.size() - frame_count) % ring_.size();
+
+        next_slot_   = 0;
+        frame_count_ = 0;
+    }
+
+    if (frame_count == 0) return;
+
+    auto path = SessionWriter::unique_directory(params_.path, "flight");
+    ROS_WARN("Dumping flight recorder to %s (%s)",
+             path.string().c_str(),
+             reason.c_str());
+
+    size_t newest = (first + frame_count - 1) % dump_ring_.size();
+
+    // the ring may cover more than the requested duration if the actual
+    // frame rate is below the expected one
+    double begin =
+        dump_ring_[newest].image.header.stamp.toSec() - params_.duration;
+
+    SessionWriter writer(path, camera_info_);
+    size_t written = 0;
+    for (size_t i = 0; i < frame_count; ++i)
+    {
+        auto& frame = dump_ring_[(first + i) % dump_ring_.size()];
+        if (frame.image.header.stamp.toSec() < begin) continue;
+        if (!writer.write(frame.image, frame.states)) break;
+        ++written;
+    }
+    writer.close();
+
+    ROS_WARN("Flight recorder dumped %zu frames to %s, %zu frames dropped",
+             written,
+             path.string().c_str(),
+             dropped_frames());
+}
+}
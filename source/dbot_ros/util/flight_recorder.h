@@ -0,0 +1,146 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file flight_recorder.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <dbot_ros/util/runtime_parameters.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <mutex>
+#include <sensor_msgs/CameraInfo.h>
+#include <sensor_msgs/Image.h>
+#include <std_srvs/Trigger.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Keeps the most recent tracking inputs and estimates in a
+ * preallocated ring buffer and dumps them to disk when triggered.
+ *
+ * Recording only copies the frame into a ring slot and never blocks. A dump
+ * runs on a dedicated thread and writes a SessionWriter directory. The ring
+ * is double buffered, i.e. a dump swaps the recorded frames with a second,
+ * equally preallocated ring and writes them while recording continues into
+ * the other one. Frames are only skipped during the swap itself and
+ * counted.
+ *
+ * Dumps are triggered explicitly via trigger() or the Trigger service
+ * callback, or automatically if a recorded frame breaches the latency limit
+ * or looks like a tracking loss, i.e. the estimate is not finite or an object
+ * jumps further than the configured limits between two frames.
+ */
+class FlightRecorder
+{
+public:
+    typedef FlightRecorderParameters Parameters;
+
+public:
+    /**
+     * \brief Creates a FlightRecorder and preallocates its ring buffers
+     * \param camera_info
+     * 			Camera info written along with every image. Its resolution
+     * 			is used to preallocate the image buffers.
+     * \param object_count
+     * 			Number of tracked objects used to preallocate the states
+     */
+    FlightRecorder(const Parameters& params,
+                   const sensor_msgs::CameraInfo& camera_info,
+                   size_t object_count);
+
+    /**
+     * \brief Finishes a running dump and stops the dump thread
+     */
+    ~FlightRecorder();
+
+    /**
+     * \brief Stores a frame in the ring buffer and checks the automatic
+     *        triggers. Never blocks.
+     * \param latency
+     * 			Time in seconds between image acquisition and the estimate
+     */
+    void record(const sensor_msgs::Image& image,
+                const std::vector<dbot_ros_msgs::ObjectState>& states,
+                double latency);
+
+    /**
+     * \brief Requests an asynchronous dump of the ring buffer
+     * \return false if a dump is already in progress
+     */
+    bool trigger(const std::string& reason);
+
+    /**
+     * \brief Trigger service callback
+     */
+    bool trigger_srv(std_srvs::Trigger::Request& req,
+                     std_srvs::Trigger::Response& res);
+
+    /**
+     * \brief Number of frames skipped because the ring was being swapped
+     */
+    size_t dropped_frames() const;
+
+private:
+    struct Frame
+    {
+        sensor_msgs::Image image;
+        std::vector<dbot_ros_msgs::ObjectState> states;
+    };
+
+    bool is_tracking_loss(
+        const std::vector<dbot_ros_msgs::ObjectState>& states) const;
+    void dump_loop();
+    void dump(const std::string& reason);
+
+private:
+    Parameters params_;
+    sensor_msgs::CameraInfo camera_info_;
+
+    /**
+     * \brief Ring buffer slots. Guarded by ring_mutex_ which recording only
+     *        tries to lock.
+     */
+    std::vector<Frame> ring_;
+    size_t next_slot_;
+    size_t frame_count_;
+    std::mutex ring_mutex_;
+    std::atomic<size_t> dropped_frames_;
+
+    /**
+     * \brief Ring being dumped, only accessed by the dump thread apart from
+     *        swapping it with ring_
+     */
+    std::vector<Frame> dump_ring_;
+
+    std::vector<dbot_ros_msgs::ObjectState> previous_states_;
+    std::chrono::steady_clock::time_point last_automatic_trigger_;
+
+    /**
+     * \brief Dump request state, guarded by dump_mutex_
+     */
+    bool dump_requested_;
+    std::string dump_reason_;
+    bool running_;
+    std::mutex dump_mutex_;
+    std::condition_variable dump_condition_;
+    std::thread dump_thread_;
+};
+}
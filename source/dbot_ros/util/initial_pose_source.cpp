@@ -0,0 +1,381 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file initial_pose_source.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <dbot_ros/util/initial_pose_source.h>
+#include <dbot_ros_msgs/FindObject.h>
+#include <fstream>
+
+namespace dbot
+{
+namespace
+{
+/**
+ * \brief Returns why \c poses cannot initialize the tracked objects or an
+ * empty string if they can
+ */
+std::string check_poses(const geometry_msgs::PoseArray& poses,
+                        const std::string& camera_frame_id,
+                        int object_count)
+{
+    if (int(poses.poses.size()) != object_count)
+    {
+        return "Expected " + std::to_string(object_count) + " poses, got " +
+               std::to_string(poses.poses.size());
+    }
+
+    if (!poses.header.frame_id.empty() &&
+        poses.header.frame_id != camera_frame_id)
+    {
+        return "Expected poses in the camera frame " + camera_frame_id +
+               ", got " + poses.header.frame_id;
+    }
+
+    return "";
+}
+}
+
+InitialPoseSource::InitialPoseSource() : available_(false), failed_(false)
+{
+}
+
+bool InitialPoseSource::wait_for_poses(double timeout,
+                                       std::vector<geometry_msgs::Pose>& poses)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                       std::chrono::duration<double>(timeout));
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!available_ && !failed_)
+    {
+        if (!ros::ok()) return false;
+
+        // woken up by provide() and fail(), and periodically to notice a
+        // shutdown
+        auto next = Clock::now() + std::chrono::milliseconds(100);
+        if (timeout > 0.0)
+        {
+            if (Clock::now() >= deadline) return false;
+            next = std::min(next, deadline);
+        }
+        condition_.wait_until(lock, next);
+    }
+
+    if (failed_) return false;
+
+    poses = poses_;
+    return true;
+}
+
+void InitialPoseSource::provide(const std::vector<geometry_msgs::Pose>& poses)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (available_) return;
+        poses_     = poses;
+        available_ = true;
+    }
+    condition_.notify_all();
+}
+
+void InitialPoseSource::fail()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failed_ = true;
+    }
+    condition_.notify_all();
+}
+
+InteractivePoseSource::InteractivePoseSource(
+    const std::string& camera_frame_id,
+    const ObjectResourceIdentifier& ori,
+    bool accept_cached_poses)
+{
+    initializer_ = std::make_shared<opi::InteractiveMarkerInitializer>(
+        camera_frame_id,
+        ori.package(),
+        ori.directory(),
+        ori.meshes(),
+        std::vector<geometry_msgs::Pose>(),
+        true,
+        accept_cached_poses);
+
+    // the marker feedback is served by the spinner threads, hence the
+    // callback is registered atomically with checking for the poses
+    bool poses_set = initializer_->poses_update_callback_if_unset(
+        [this](const geometry_msgs::PoseArray& poses) {
+            provide(poses.poses);
+        },
+        accept_cached_poses);
+    if (poses_set) return;
+
+    ROS_INFO(
+        "Please use rviz to align and initialize the object poses. Waiting "
+        "for all interactive object poses to be set ...");
+}
+
+TopicPoseSource::TopicPoseSource(ros::NodeHandle& node_handle,
+                                 const std::string& topic,
+                                 const std::string& camera_frame_id,
+                                 int object_count)
+    : camera_frame_id_(camera_frame_id), object_count_(object_count)
+{
+    subscriber_ =
+        node_handle.subscribe(topic, 1, &TopicPoseSource::callback, this);
+    ROS_INFO("Waiting for initial object poses on %s ...",
+             subscriber_.getTopic().c_str());
+}
+
+void TopicPoseSource::callback(const geometry_msgs::PoseArray& poses)
+{
+    auto error = check_poses(poses, camera_frame_id_, object_count_);
+    if (!error.empty())
+    {
+        ROS_WARN("Ignoring initial object poses. %s", error.c_str());
+        return;
+    }
+
+    provide(poses.poses);
+}
+
+ServicePoseSource::ServicePoseSource(ros::NodeHandle& node_handle,
+                                     const std::string& service,
+                                     const std::string& camera_frame_id,
+                                     int object_count)
+    : camera_frame_id_(camera_frame_id), object_count_(object_count)
+{
+    service_ = node_handle.advertiseService(
+        service, &ServicePoseSource::set_poses_srv, this);
+    ROS_INFO("Waiting for initial object poses through %s ...",
+             service_.getService().c_str());
+}
+
+bool ServicePoseSource::set_poses_srv(dbot_ros::SetInitialPoses::Request& req,
+                                      dbot_ros::SetInitialPoses::Response& res)
+{
+    res.message = check_poses(req.poses, camera_frame_id_, object_count_);
+    res.success = res.message.empty();
+    if (res.success)
+    {
+        res.message = "Initial object poses set";
+        provide(req.poses.poses);
+    }
+
+    return true;
+}
+
+FilePoseSource::FilePoseSource(const std::string& path, int object_count)
+{
+    std::ifstream file(path);
+    std::vector<geometry_msgs::Pose> poses(object_count);
+    for (auto& pose : poses)
+    {
+        file >> pose.position.x >> pose.position.y >> pose.position.z >>
+            pose.orientation.w >> pose.orientation.x >> pose.orientation.y >>
+            pose.orientation.z;
+
+        double length = std::sqrt(
+            std::pow(pose.orientation.w, 2) + std::pow(pose.orientation.x, 2) +
+            std::pow(pose.orientation.y, 2) + std::pow(pose.orientation.z, 2));
+        if (!file || length <= 0.0)
+        {
+            ROS_ERROR("Cannot read %d initial object poses from %s",
+                      object_count,
+                      path.c_str());
+            fail();
+            return;
+        }
+
+        pose.orientation.w /= length;
+        pose.orientation.x /= length;
+        pose.orientation.y /= length;
+        pose.orientation.z /= length;
+    }
+
+    provide(poses);
+}
+
+CheckpointPoseSource::CheckpointPoseSource(
+    const ObjectResourceIdentifier& ori,
+    const BeliefCheckpoint::Parameters& params)
+{
+    std::vector<dbot_ros_msgs::ObjectState> states;
+    if (!BeliefCheckpoint::load(ori, params, states))
+    {
+        fail();
+        return;
+    }
+
+    std::vector<geometry_msgs::Pose> poses;
+    for (auto& state : states) poses.push_back(state.pose.pose);
+    provide(poses);
+}
+
+ObjectFinderPoseSource::ObjectFinderPoseSource(
+    ros::NodeHandle& node_handle,
+    const std::string& service,
+    const ObjectResourceIdentifier& ori)
+    : stop_(false)
+{
+    thread_ = std::thread(
+        &ObjectFinderPoseSource::run, this, node_handle, service, ori);
+}
+
+ObjectFinderPoseSource::~ObjectFinderPoseSource()
+{
+    stop_ = true;
+    thread_.join();
+}
+
+void ObjectFinderPoseSource::run(ros::NodeHandle node_handle,
+                                 std::string service,
+                                 ObjectResourceIdentifier ori)
+{
+    auto client = node_handle.serviceClient<dbot_ros_msgs::FindObject>(service);
+    ROS_INFO("Waiting for the object finder %s ...", service.c_str());
+    while (!client.waitForExistence(ros::Duration(0.5)))
+    {
+        if (stop_ || !ros::ok()) return;
+    }
+
+    std::vector<geometry_msgs::Pose> poses;
+    for (int i = 0; i < ori.count_meshes() && !stop_; ++i)
+    {
+        dbot_ros_msgs::FindObject find_object_srv;
+        find_object_srv.request.object_ori.package   = ori.package();
+        find_object_srv.request.object_ori.directory = ori.directory();
+        find_object_srv.request.object_ori.name      = ori.mesh(i);
+        if (!client.call(find_object_srv))
+        {
+            ROS_ERROR("Finding object '%s' failed.", ori.mesh(i).c_str());
+            fail();
+            return;
+        }
+
+        poses.push_back(find_object_srv.response.found_object.pose.pose);
+    }
+
+    if (!stop_) provide(poses);
+}
+
+std::shared_ptr<InitialPoseSource> create_initial_pose_source(
+    const std::string& type,
+    ros::NodeHandle& node_handle,
+    const std::string& prefix,
+    const ObjectResourceIdentifier& ori,
+    const std::string& camera_frame_id)
+{
+    if (type == "interactive")
+    {
+        bool use_cached_poses = false;
+        node_handle.getParam("use_cached_poses", use_cached_poses);
+        return std::make_shared<InteractivePoseSource>(
+            camera_frame_id, ori, use_cached_poses);
+    }
+
+    if (type == "topic")
+    {
+        std::string topic = "initial_poses";
+        node_handle.getParam(prefix + "topic", topic);
+        return std::make_shared<TopicPoseSource>(
+            node_handle, topic, camera_frame_id, ori.count_meshes());
+    }
+
+    if (type == "service")
+    {
+        std::string service = "set_initial_poses";
+        node_handle.getParam(prefix + "service", service);
+        return std::make_shared<ServicePoseSource>(
+            node_handle, service, camera_frame_id, ori.count_meshes());
+    }
+
+    if (type == "file")
+    {
+        std::string path = "/tmp/dbot_initial_poses.txt";
+        node_handle.getParam(prefix + "file", path);
+        return std::make_shared<FilePoseSource>(path, ori.count_meshes());
+    }
+
+    if (type == "checkpoint")
+    {
+        BeliefCheckpoint::Parameters params;
+        node_handle.getParam("belief_checkpoint/path", params.path);
+        node_handle.getParam("belief_checkpoint/max_age", params.max_age);
+        return std::make_shared<CheckpointPoseSource>(ori, params);
+    }
+
+    if (type == "object_finder")
+    {
+        std::string service = "/object_finder";
+        node_handle.getParam(prefix + "object_finder_service", service);
+        return std::make_shared<ObjectFinderPoseSource>(
+            node_handle, service, ori);
+    }
+
+    return std::shared_ptr<InitialPoseSource>();
+}
+
+std::shared_ptr<InitialPoseSource> wait_for_initial_poses(
+    ros::NodeHandle& node_handle,
+    const std::string& prefix,
+    const ObjectResourceIdentifier& ori,
+    const std::string& camera_frame_id,
+    std::vector<geometry_msgs::Pose>& poses)
+{
+    std::vector<std::string> types = {"interactive"};
+    double timeout                  = 0.0;
+    node_handle.getParam(prefix + "sources", types);
+    node_handle.getParam(prefix + "timeout", timeout);
+
+    bool use_cached_poses  = false;
+    bool checkpoint_belief = false;
+    node_handle.getParam("use_cached_poses", use_cached_poses);
+    node_handle.getParam("belief_checkpoint/enabled", checkpoint_belief);
+    if (use_cached_poses && checkpoint_belief &&
+        std::find(types.begin(), types.end(), "checkpoint") == types.end())
+    {
+        types.insert(types.begin(), "checkpoint");
+    }
+
+    for (auto& type : types)
+    {
+        auto source = create_initial_pose_source(
+            type, node_handle, prefix, ori, camera_frame_id);
+        if (!source)
+        {
+            ROS_ERROR("Unknown initial pose source '%s'", type.c_str());
+            continue;
+        }
+
+        if (source->wait_for_poses(timeout, poses))
+        {
+            ROS_INFO("Initial object poses provided by %s", type.c_str());
+            return source;
+        }
+
+        if (!ros::ok()) break;
+        ROS_INFO("No initial object poses provided by %s", type.c_str());
+    }
+
+    return std::shared_ptr<InitialPoseSource>();
+}
+}
@@ -0,0 +1,211 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file initial_pose_source.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/SetInitialPoses.h>
+#include <dbot_ros/util/belief_checkpoint.h>
+#include <dbot_ros/util/interactive_marker_initializer.h>
+#include <geometry_msgs/Pose.h>
+#include <geometry_msgs/PoseArray.h>
+#include <memory>
+#include <mutex>
+#include <ros/ros.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Provides the poses of all tracked objects a tracker is initialized
+ * with.
+ *
+ * Sources provide the poses from ROS callbacks or their own threads, hence a
+ * spinner, e.g. a ros::AsyncSpinner, has to process the global callback
+ * queue while waiting.
+ */
+class InitialPoseSource
+{
+public:
+    InitialPoseSource();
+
+    virtual ~InitialPoseSource() {}
+
+    /**
+     * \brief Blocks until the poses of all objects are available
+     * \param timeout  [s], zero waits indefinitely
+     * \param poses    object poses in the camera frame
+     * \return false on timeout, failure of the source or shutdown
+     */
+    bool wait_for_poses(double timeout,
+                        std::vector<geometry_msgs::Pose>& poses);
+
+protected:
+    /**
+     * \brief Provides the poses and wakes up the waiting thread. May be
+     * called from any thread.
+     */
+    void provide(const std::vector<geometry_msgs::Pose>& poses);
+
+    /**
+     * \brief Wakes up the waiting thread without poses
+     */
+    void fail();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool available_;
+    bool failed_;
+    std::vector<geometry_msgs::Pose> poses_;
+};
+
+/**
+ * \brief Poses aligned in rviz using interactive markers
+ */
+class InteractivePoseSource : public InitialPoseSource
+{
+public:
+    /**
+     * \param accept_cached_poses  Provides the poses cached by a previous run
+     *                             right away if available
+     */
+    InteractivePoseSource(const std::string& camera_frame_id,
+                          const ObjectResourceIdentifier& ori,
+                          bool accept_cached_poses);
+
+private:
+    std::shared_ptr<opi::InteractiveMarkerInitializer> initializer_;
+};
+
+/**
+ * \brief The first geometry_msgs/PoseArray received on a topic
+ */
+class TopicPoseSource : public InitialPoseSource
+{
+public:
+    TopicPoseSource(ros::NodeHandle& node_handle,
+                    const std::string& topic,
+                    const std::string& camera_frame_id,
+                    int object_count);
+
+private:
+    void callback(const geometry_msgs::PoseArray& poses);
+
+private:
+    std::string camera_frame_id_;
+    int object_count_;
+    ros::Subscriber subscriber_;
+};
+
+/**
+ * \brief The poses of the first valid SetInitialPoses service call
+ */
+class ServicePoseSource : public InitialPoseSource
+{
+public:
+    ServicePoseSource(ros::NodeHandle& node_handle,
+                      const std::string& service,
+                      const std::string& camera_frame_id,
+                      int object_count);
+
+private:
+    bool set_poses_srv(dbot_ros::SetInitialPoses::Request& req,
+                       dbot_ros::SetInitialPoses::Response& res);
+
+private:
+    std::string camera_frame_id_;
+    int object_count_;
+    ros::ServiceServer service_;
+};
+
+/**
+ * \brief Poses read from a text file containing the position and the
+ * orientation quaternion "x y z qw qx qy qz" per object
+ */
+class FilePoseSource : public InitialPoseSource
+{
+public:
+    FilePoseSource(const std::string& path, int object_count);
+};
+
+/**
+ * \brief Poses of a belief checkpoint written by a previous run
+ */
+class CheckpointPoseSource : public InitialPoseSource
+{
+public:
+    CheckpointPoseSource(const ObjectResourceIdentifier& ori,
+                         const BeliefCheckpoint::Parameters& params);
+};
+
+/**
+ * \brief Poses detected by an object finder service, see
+ * dbot_ros_msgs/FindObject. The service is called for one object after
+ * another from a dedicated thread once it is available.
+ */
+class ObjectFinderPoseSource : public InitialPoseSource
+{
+public:
+    ObjectFinderPoseSource(ros::NodeHandle& node_handle,
+                           const std::string& service,
+                           const ObjectResourceIdentifier& ori);
+
+    ~ObjectFinderPoseSource();
+
+private:
+    void run(ros::NodeHandle node_handle,
+             std::string service,
+             ObjectResourceIdentifier ori);
+
+private:
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+/**
+ * \brief Creates the source \c type configured below \c prefix, i.e. one of
+ * interactive, topic, service, file, checkpoint and object_finder
+ * \return null for unknown types
+ */
+std::shared_ptr<InitialPoseSource> create_initial_pose_source(
+    const std::string& type,
+    ros::NodeHandle& node_handle,
+    const std::string& prefix,
+    const ObjectResourceIdentifier& ori,
+    const std::string& camera_frame_id);
+
+/**
+ * \brief Tries the sources listed in <prefix>sources in the given order until
+ * one provides the poses of all objects within <prefix>timeout. A source is
+ * only created once it is tried. With use_cached_poses and an enabled belief
+ * checkpoint, the checkpoint is tried first.
+ *
+ * \return The source which provided the poses or null if none did. The
+ *         caller keeps it alive, e.g. to keep the interactive markers.
+ */
+std::shared_ptr<InitialPoseSource> wait_for_initial_poses(
+    ros::NodeHandle& node_handle,
+    const std::string& prefix,
+    const ObjectResourceIdentifier& ori,
+    const std::string& camera_frame_id,
+    std::vector<geometry_msgs::Pose>& poses);
+}
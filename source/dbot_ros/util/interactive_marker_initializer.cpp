@@ -153,11 +153,26 @@ void InteractiveMarkerInitializer::set_objects(
 
 void InteractiveMarkerInitializer::poses_update_callback(Callback callback)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     poses_update_callback_ = callback;
 }
 
+bool InteractiveMarkerInitializer::poses_update_callback_if_unset(
+    Callback callback,
+    bool accept_cached_poses)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    poses_update_callback_ = callback;
+
+    if (!are_all_object_poses_set(accept_cached_poses)) return false;
+
+    poses_update_callback_(pose_array());
+    return true;
+}
+
 void InteractiveMarkerInitializer::delete_poses_update_callback()
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     poses_update_callback_ = Callback();
 }
 
@@ -112,6 +112,16 @@ public:
      */
     void poses_update_callback(Callback callback);
 
+    /**
+     * \brief Sets the callback function for object poses update and calls it
+     *        right away if all object poses are set already. The check and
+     *        the registration happen under the marker feedback lock, i.e. an
+     *        alignment completed in between is not missed.
+     * \return True if all object poses were set already
+     */
+    bool poses_update_callback_if_unset(Callback callback,
+                                        bool accept_cached_poses = false);
+
     void switch_marker(visualization_msgs::InteractiveMarker& int_marker,
                        bool active);
 
@@ -0,0 +1,146 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file mesh_decimation.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <dbot_ros/util/mesh_decimation.h>
+#include <map>
+#include <set>
+
+namespace dbot
+{
+namespace
+{
+typedef std::array<int64_t, 3> Cell;
+
+/**
+ * \brief Single clustering pass with the given cell size
+ */
+void cluster(double cell_size,
+             const std::vector<Eigen::Vector3d>& vertices,
+             const std::vector<std::vector<int>>& triangle_indices,
+             std::vector<Eigen::Vector3d>& clustered_vertices,
+             std::vector<std::vector<int>>& clustered_triangle_indices)
+{
+    Eigen::Vector3d origin = vertices[0];
+    for (auto& vertex : vertices) origin = origin.cwiseMin(vertex);
+
+    std::map<Cell, int> cells;
+    std::vector<int> cluster_of(vertices.size());
+    std::vector<int> counts;
+    clustered_vertices.clear();
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        Eigen::Vector3d position = (vertices[i] - origin) / cell_size;
+        Cell cell = {{int64_t(std::floor(position(0))),
+                      int64_t(std::floor(position(1))),
+                      int64_t(std::floor(position(2)))}};
+
+        auto inserted = cells.insert(std::make_pair(cell, int(counts.size())));
+        if (inserted.second)
+        {
+            clustered_vertices.push_back(Eigen::Vector3d::Zero());
+            counts.push_back(0);
+        }
+
+        int index     = inserted.first->second;
+        cluster_of[i] = index;
+        clustered_vertices[index] += vertices[i];
+        counts[index]++;
+    }
+
+    for (size_t i = 0; i < clustered_vertices.size(); ++i)
+    {
+        clustered_vertices[i] /= counts[i];
+    }
+
+    std::set<std::array<int, 3>> unique_triangles;
+    clustered_triangle_indices.clear();
+    for (auto& triangle : triangle_indices)
+    {
+        std::array<int, 3> clustered = {{cluster_of[triangle[0]],
+                                         cluster_of[triangle[1]],
+                                         cluster_of[triangle[2]]}};
+        if (clustered[0] == clustered[1] || clustered[1] == clustered[2] ||
+            clustered[2] == clustered[0])
+        {
+            continue;
+        }
+
+        auto key = clustered;
+        std::sort(key.begin(), key.end());
+        if (!unique_triangles.insert(key).second) continue;
+
+        clustered_triangle_indices.push_back(
+            std::vector<int>(clustered.begin(), clustered.end()));
+    }
+}
+}
+
+void decimate_mesh(const MeshDecimation& decimation,
+                   std::vector<Eigen::Vector3d>& vertices,
+                   std::vector<std::vector<int>>& triangle_indices)
+{
+    if (!decimation.enabled() || vertices.empty()) return;
+
+    bool limited = decimation.max_triangles > 0;
+    if (decimation.tolerance <= 0.0 &&
+        int(triangle_indices.size()) <= decimation.max_triangles)
+    {
+        return;
+    }
+
+    // without tolerance, the search for the triangle limit starts at a cell
+    // size far below the extent of the mesh
+    double cell_size = decimation.tolerance;
+    if (cell_size <= 0.0)
+    {
+        Eigen::Vector3d lower = vertices[0];
+        Eigen::Vector3d upper = vertices[0];
+        for (auto& vertex : vertices)
+        {
+            lower = lower.cwiseMin(vertex);
+            upper = upper.cwiseMax(vertex);
+        }
+        cell_size = 1e-3 * (upper - lower).norm();
+        if (cell_size <= 0.0) return;
+    }
+
+    std::vector<Eigen::Vector3d> clustered_vertices;
+    std::vector<std::vector<int>> clustered_triangle_indices;
+    while (true)
+    {
+        cluster(cell_size,
+                vertices,
+                triangle_indices,
+                clustered_vertices,
+                clustered_triangle_indices);
+
+        if (!limited ||
+            int(clustered_triangle_indices.size()) <= decimation.max_triangles)
+        {
+            break;
+        }
+
+        cell_size *= 1.25;
+    }
+
+    vertices.swap(clustered_vertices);
+    triangle_indices.swap(clustered_triangle_indices);
+}
+}
@@ -0,0 +1,53 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file mesh_decimation.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Level of detail of a mesh. A default constructed instance keeps the
+ * mesh as is.
+ */
+struct MeshDecimation
+{
+    MeshDecimation() : tolerance(0.0), max_triangles(0) {}
+
+    bool enabled() const { return tolerance > 0.0 || max_triangles > 0; }
+
+    /// size of the vertex clustering cells [m], i.e. the approximate
+    /// geometric error. 0 for none
+    double tolerance;
+    /// the cells are enlarged until at most max_triangles remain. 0 for no
+    /// limit
+    int max_triangles;
+};
+
+/**
+ * \brief Decimates the mesh by vertex clustering.
+ *
+ * The vertices within each cell of a grid are merged into their mean.
+ * Triangles collapsing to an edge or point, and duplicates, are removed.
+ * The orientation of the remaining triangles is preserved.
+ */
+void decimate_mesh(const MeshDecimation& decimation,
+                   std::vector<Eigen::Vector3d>& vertices,
+                   std::vector<std::vector<int>>& triangle_indices);
+}
@@ -0,0 +1,81 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file object_state_conversion.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Conversions of the tracker estimates into ObjectState messages and of
+ * those into shared pose channel entries. Kept apart from ros_interface.h,
+ * which only depends on the standard ROS messages.
+ */
+
+#pragma once
+
+#include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/shared_pose_channel.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <std_msgs/Header.h>
+#include <vector>
+
+namespace ri
+{
+/**
+ * \brief Converts the object poses and velocities of a
+ *        FreeFloatingRigidBodiesState into ObjectState messages
+ */
+template <typename State>
+std::vector<dbot_ros_msgs::ObjectState> to_object_states(
+    const State& state, int object_count, const std_msgs::Header& header)
+{
+    std::vector<dbot_ros_msgs::ObjectState> object_states(object_count);
+    for (int i = 0; i < object_count; ++i)
+    {
+        object_states[i].pose.header     = header;
+        object_states[i].pose.pose       = to_ros_pose(state.component(i));
+        object_states[i].velocity.header = header;
+        object_states[i].velocity.twist  = to_ros_velocity(state.component(i));
+    }
+
+    return object_states;
+}
+
+/**
+ * \brief Converts ObjectState messages into shared pose channel entries
+ */
+inline std::vector<dbot::SharedPose> to_shared_poses(
+    const std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    std::vector<dbot::SharedPose> poses(states.size());
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        auto& pose     = states[i].pose.pose;
+        auto& velocity = states[i].velocity.twist;
+
+        poses[i].position[0]         = pose.position.x;
+        poses[i].position[1]         = pose.position.y;
+        poses[i].position[2]         = pose.position.z;
+        poses[i].orientation[0]      = pose.orientation.w;
+        poses[i].orientation[1]      = pose.orientation.x;
+        poses[i].orientation[2]      = pose.orientation.y;
+        poses[i].orientation[3]      = pose.orientation.z;
+        poses[i].linear_velocity[0]  = velocity.linear.x;
+        poses[i].linear_velocity[1]  = velocity.linear.y;
+        poses[i].linear_velocity[2]  = velocity.linear.z;
+        poses[i].angular_velocity[0] = velocity.angular.x;
+        poses[i].angular_velocity[1] = velocity.angular.y;
+        poses[i].angular_velocity[2] = velocity.angular.z;
+    }
+
+    return poses;
+}
+}
@@ -0,0 +1,203 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file parameter_reader.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot_ros/util/parameter_reader.h>
+#include <dbot_ros/util/ros_interface.h>
+#include <stdexcept>
+
+namespace dbot
+{
+/* ------------------------------ */
+/* - Parameter server           - */
+/* ------------------------------ */
+RosParameterSource::RosParameterSource(const ros::NodeHandle& node_handle)
+    : node_handle_(node_handle)
+{
+}
+
+bool RosParameterSource::has(const std::string& path) const
+{
+    return node_handle_.hasParam(path);
+}
+
+std::vector<std::string> RosParameterSource::keys(
+    const std::string& path) const
+{
+    std::vector<std::string> keys;
+
+    XmlRpc::XmlRpcValue ros_parameter;
+    if (!node_handle_.getParam(path, ros_parameter) ||
+        ros_parameter.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+    {
+        return keys;
+    }
+
+    for (auto& member : ros_parameter)
+    {
+        keys.push_back(member.first);
+    }
+
+    return keys;
+}
+
+std::string RosParameterSource::resolve(const std::string& path) const
+{
+    return node_handle_.resolveName(path);
+}
+
+void RosParameterSource::read(const std::string& path, bool& value) const
+{
+    value = ri::read<bool>(path, node_handle_);
+}
+
+void RosParameterSource::read(const std::string& path, int& value) const
+{
+    value = ri::read<int>(path, node_handle_);
+}
+
+void RosParameterSource::read(const std::string& path, double& value) const
+{
+    value = ri::read<double>(path, node_handle_);
+}
+
+void RosParameterSource::read(const std::string& path,
+                              std::string& value) const
+{
+    value = ri::read<std::string>(path, node_handle_);
+}
+
+void RosParameterSource::read(const std::string& path,
+                              std::vector<std::string>& value) const
+{
+    value = ri::read<std::vector<std::string>>(path, node_handle_);
+}
+
+/* ------------------------------ */
+/* - YAML files                 - */
+/* ------------------------------ */
+YamlParameterSource::YamlParameterSource(const YamlConfig& config)
+    : config_(config)
+{
+}
+
+bool YamlParameterSource::has(const std::string& path) const
+{
+    return config_.find(path).IsDefined();
+}
+
+std::vector<std::string> YamlParameterSource::keys(
+    const std::string& path) const
+{
+    std::vector<std::string> keys;
+
+    const YAML::Node node = config_.find(path);
+    if (!node.IsMap()) return keys;
+
+    for (auto it = node.begin(); it != node.end(); ++it)
+    {
+        keys.push_back(it->first.as<std::string>());
+    }
+
+    return keys;
+}
+
+std::string YamlParameterSource::resolve(const std::string& path) const
+{
+    return path;
+}
+
+template <typename T>
+void YamlParameterSource::read_node(const std::string& path, T& value) const
+{
+    const YAML::Node node = config_.find(path);
+    if (!node.IsDefined())
+    {
+        throw std::runtime_error("Could not read parameter at " + path);
+    }
+
+    try
+    {
+        value = node.as<T>();
+    }
+    catch (YAML::Exception& e)
+    {
+        throw std::runtime_error("Parameter at " + path +
+                                 " has an unexpected type");
+    }
+}
+
+void YamlParameterSource::read(const std::string& path, bool& value) const
+{
+    read_node(path, value);
+}
+
+void YamlParameterSource::read(const std::string& path, int& value) const
+{
+    read_node(path, value);
+}
+
+void YamlParameterSource::read(const std::string& path, double& value) const
+{
+    read_node(path, value);
+}
+
+void YamlParameterSource::read(const std::string& path,
+                               std::string& value) const
+{
+    read_node(path, value);
+}
+
+void YamlParameterSource::read(const std::string& path,
+                               std::vector<std::string>& value) const
+{
+    read_node(path, value);
+}
+
+/* ------------------------------ */
+/* - Reader                     - */
+/* ------------------------------ */
+ParameterReader::ParameterReader(const ros::NodeHandle& node_handle)
+    : source_(std::make_shared<RosParameterSource>(node_handle))
+{
+}
+
+ParameterReader::ParameterReader(const YamlConfig& config)
+    : source_(std::make_shared<YamlParameterSource>(config))
+{
+}
+
+ParameterReader::ParameterReader(
+    const std::shared_ptr<ParameterSource>& source)
+    : source_(source)
+{
+}
+
+std::vector<std::string> ParameterReader::keys(const std::string& path) const
+{
+    return source_->keys(path);
+}
+
+bool ParameterReader::report() const
+{
+    for (auto& error : errors_)
+    {
+        ROS_ERROR("%s", error.c_str());
+    }
+
+    return errors_.empty();
+}
+}
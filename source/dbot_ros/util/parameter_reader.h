@@ -0,0 +1,229 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file parameter_reader.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Validated parameter reads from the ROS parameter server or, for the
+ * offline tools, from YAML files.
+ */
+
+#pragma once
+
+#include <dbot_ros/util/yaml_config.h>
+#include <limits>
+#include <memory>
+#include <ros/ros.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Source of the tracker parameters addressed by slash separated paths
+ * relative to a namespace
+ */
+class ParameterSource
+{
+public:
+    virtual ~ParameterSource() {}
+
+    /**
+     * \brief Returns whether the parameter at \c path exists
+     */
+    virtual bool has(const std::string& path) const = 0;
+
+    /**
+     * \brief Returns the names of the parameters directly below \c path, or
+     * an empty vector if \c path is not a map
+     */
+    virtual std::vector<std::string> keys(const std::string& path) const = 0;
+
+    /**
+     * \brief Returns the fully qualified name of \c path for messages
+     */
+    virtual std::string resolve(const std::string& path) const = 0;
+
+    /**
+     * \brief Reads the parameter at \c path
+     * \throws std::runtime_error if the parameter does not exist or its type
+     *         does not match
+     */
+    virtual void read(const std::string& path, bool& value) const        = 0;
+    virtual void read(const std::string& path, int& value) const         = 0;
+    virtual void read(const std::string& path, double& value) const      = 0;
+    virtual void read(const std::string& path, std::string& value) const = 0;
+    virtual void read(const std::string& path,
+                      std::vector<std::string>& value) const = 0;
+};
+
+/**
+ * \brief Reads the parameters from the parameter server relative to the
+ * namespace of a node handle
+ */
+class RosParameterSource : public ParameterSource
+{
+public:
+    explicit RosParameterSource(const ros::NodeHandle& node_handle);
+
+    bool has(const std::string& path) const;
+    std::vector<std::string> keys(const std::string& path) const;
+    std::string resolve(const std::string& path) const;
+
+    void read(const std::string& path, bool& value) const;
+    void read(const std::string& path, int& value) const;
+    void read(const std::string& path, double& value) const;
+    void read(const std::string& path, std::string& value) const;
+    void read(const std::string& path, std::vector<std::string>& value) const;
+
+private:
+    ros::NodeHandle node_handle_;
+};
+
+/**
+ * \brief Reads the parameters from YAML files, i.e. without a parameter
+ * server
+ */
+class YamlParameterSource : public ParameterSource
+{
+public:
+    explicit YamlParameterSource(const YamlConfig& config);
+
+    bool has(const std::string& path) const;
+    std::vector<std::string> keys(const std::string& path) const;
+    std::string resolve(const std::string& path) const;
+
+    void read(const std::string& path, bool& value) const;
+    void read(const std::string& path, int& value) const;
+    void read(const std::string& path, double& value) const;
+    void read(const std::string& path, std::string& value) const;
+    void read(const std::string& path, std::vector<std::string>& value) const;
+
+private:
+    template <typename T>
+    void read_node(const std::string& path, T& value) const;
+
+private:
+    YamlConfig config_;
+};
+
+/**
+ * \brief Reads typed parameters from a ParameterSource and collects all
+ * missing, mistyped or out of range parameters, such that a configuration is
+ * reported at once instead of failing at the first error.
+ */
+class ParameterReader
+{
+public:
+    explicit ParameterReader(const ros::NodeHandle& node_handle);
+    explicit ParameterReader(const YamlConfig& config);
+    explicit ParameterReader(const std::shared_ptr<ParameterSource>& source);
+
+    /**
+     * \brief Reads the parameter at \c path. Records an error if it does not
+     * exist or has an unexpected type.
+     */
+    template <typename T>
+    void required(const std::string& path, T& value)
+    {
+        read(path, value);
+    }
+
+    /**
+     * \brief Reads the parameter at \c path like required() and records an
+     * error if it lies outside of [\c min, \c max]
+     */
+    template <typename T>
+    void required(const std::string& path,
+                  T& value,
+                  T min,
+                  T max = std::numeric_limits<T>::max())
+    {
+        if (read(path, value)) check_range(path, value, min, max);
+    }
+
+    /**
+     * \brief Reads the parameter at \c path if it exists and keeps \c value
+     * otherwise. Records an error if it has an unexpected type.
+     */
+    template <typename T>
+    void optional(const std::string& path, T& value)
+    {
+        if (source_->has(path)) read(path, value);
+    }
+
+    /**
+     * \brief Reads the parameter at \c path like optional() and records an
+     * error if it lies outside of [\c min, \c max]
+     */
+    template <typename T>
+    void optional(const std::string& path,
+                  T& value,
+                  T min,
+                  T max = std::numeric_limits<T>::max())
+    {
+        if (source_->has(path)) required(path, value, min, max);
+    }
+
+    /**
+     * \brief Returns the names of the parameters directly below \c path
+     */
+    std::vector<std::string> keys(const std::string& path) const;
+
+    /**
+     * \brief Logs all recorded errors
+     * \return true if no error was recorded
+     */
+    bool report() const;
+
+private:
+    template <typename T>
+    bool read(const std::string& path, T& value)
+    {
+        try
+        {
+            source_->read(path, value);
+            return true;
+        }
+        catch (std::exception& e)
+        {
+            errors_.push_back(e.what());
+            return false;
+        }
+    }
+
+    template <typename T>
+    void check_range(const std::string& path, const T& value, T min, T max)
+    {
+        if (value >= min && value <= max) return;
+
+        std::ostringstream error;
+        error << "Parameter at " << source_->resolve(path) << " is " << value
+              << ", expected ";
+        if (max == std::numeric_limits<T>::max())
+        {
+            error << "at least " << min;
+        }
+        else
+        {
+            error << "a value in [" << min << ", " << max << "]";
+        }
+        errors_.push_back(error.str());
+    }
+
+private:
+    std::shared_ptr<ParameterSource> source_;
+    std::vector<std::string> errors_;
+};
+}
@@ -0,0 +1,178 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file prefetching_frame_source.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <dbot_ros/util/prefetching_frame_source.h>
+#include <dbot_ros/util/ros_interface.h>
+
+namespace dbot
+{
+PrefetchingFrameSource::PrefetchingFrameSource(
+    const std::shared_ptr<TrackingDataset>& data_set,
+    int downsampling_factor,
+    int decoder_threads,
+    int lookahead,
+    size_t first_frame,
+    size_t frame_count)
+    : data_set_(data_set),
+      downsampling_factor_(downsampling_factor),
+      lookahead_(std::max(lookahead, 1)),
+      chunk_frames_(std::max(lookahead_ / std::max(decoder_threads, 1),
+                             size_t(1))),
+      next_to_decode_(0),
+      next_to_deliver_(0),
+      stopped_(false)
+{
+    size_t end = data_set_->Size();
+    if (frame_count > 0) end = std::min(end, first_frame + frame_count);
+
+    for (size_t i = first_frame; i < end; ++i) order_.push_back(i);
+
+    // bag order is not guaranteed to be timestamp order. The camera infos
+    // are always loaded and carry the stamps of their images
+    std::stable_sort(order_.begin(), order_.end(), [&](size_t a, size_t b) {
+        return data_set_->GetInfo(a)->header.stamp <
+               data_set_->GetInfo(b)->header.stamp;
+    });
+
+    for (int i = 0; i < std::max(decoder_threads, 1); ++i)
+    {
+        decoders_.push_back(
+            std::thread(&PrefetchingFrameSource::decode_loop, this));
+    }
+}
+
+PrefetchingFrameSource::~PrefetchingFrameSource()
+{
+    stop();
+
+    for (auto& decoder : decoders_)
+    {
+        if (decoder.joinable()) decoder.join();
+    }
+}
+
+bool PrefetchingFrameSource::next(Frame& frame)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (next_to_deliver_ >= order_.size()) return false;
+
+    frame_decoded_.wait(lock, [&]() {
+        return stopped_ || decoded_frames_.count(next_to_deliver_) > 0;
+    });
+
+    if (stopped_) return false;
+
+    auto entry = decoded_frames_.find(next_to_deliver_);
+    frame      = std::move(entry->second);
+    decoded_frames_.erase(entry);
+    ++next_to_deliver_;
+
+    frame_delivered_.notify_all();
+
+    return true;
+}
+
+size_t PrefetchingFrameSource::size() const
+{
+    return order_.size();
+}
+
+void PrefetchingFrameSource::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    frame_decoded_.notify_all();
+    frame_delivered_.notify_all();
+}
+
+void PrefetchingFrameSource::decode_loop()
+{
+    while (true)
+    {
+        size_t begin;
+        size_t end;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_delivered_.wait(lock, [&]() {
+                return stopped_ || next_to_decode_ >= order_.size() ||
+                       next_to_decode_ < next_to_deliver_ + lookahead_;
+            });
+
+            if (stopped_ || next_to_decode_ >= order_.size()) return;
+
+            begin           = next_to_decode_;
+            end             = std::min(begin + chunk_frames_, order_.size());
+            next_to_decode_ = end;
+        }
+
+        std::vector<size_t> indices(order_.begin() + begin,
+                                    order_.begin() + end);
+        std::vector<sensor_msgs::Image::ConstPtr> images;
+        try
+        {
+            images = data_set_->ReadImages(indices);
+        }
+        catch (std::exception& e)
+        {
+            ROS_ERROR("Reading frames %zu to %zu failed: %s",
+                      indices.front(),
+                      indices.back(),
+                      e.what());
+            images.resize(indices.size());
+        }
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            Frame frame;
+            frame.index = indices[i];
+            frame.stamp = data_set_->GetInfo(frame.index)->header.stamp;
+            frame.image = images[i];
+
+            // deliver frames without depth data rather than stalling the
+            // consumer waiting for their positions
+            if (!frame.image)
+            {
+                ROS_ERROR("Frame %zu has no depth image", frame.index);
+            }
+            else
+            {
+                try
+                {
+                    frame.depth = ri::to_eigen_vector<double>(
+                        *frame.image, downsampling_factor_);
+                }
+                catch (std::exception& e)
+                {
+                    ROS_ERROR("Decoding frame %zu failed: %s",
+                              frame.index,
+                              e.what());
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                decoded_frames_[begin + i] = std::move(frame);
+            }
+            frame_decoded_.notify_all();
+        }
+    }
+}
+}
@@ -0,0 +1,148 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file prefetching_frame_source.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <condition_variable>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sensor_msgs/Image.h>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Replays the frames of a TrackingDataset in timestamp order while a
+ * pool of decoder threads decodes the upcoming frames in the background.
+ *
+ * The decoder threads take chunks of consecutive frames. Decoding a chunk
+ * reads its depth images from the bag, unless the dataset has been loaded
+ * with its images, and converts them into the downsampled observation
+ * vectors used by the trackers. Each chunk reads only the bag range of its
+ * frames, i.e. the bag chunk decompression and the message deserialization
+ * run in parallel to the tracking.
+ *
+ * At most \c lookahead frames are decoded ahead of the consumer. Decoded
+ * frames which finish out of order are held back in a reorder buffer until
+ * all their predecessors have been delivered.
+ */
+class PrefetchingFrameSource
+{
+public:
+    /**
+     * \brief A decoded dataset frame
+     */
+    struct Frame
+    {
+        /** \brief Index of the frame within the dataset */
+        size_t index;
+        /** \brief Time stamp of the frame's camera info and image */
+        ros::Time stamp;
+        /** \brief Depth image, null if it could not be read */
+        sensor_msgs::Image::ConstPtr image;
+        /** \brief Downsampled depth image as used by the trackers */
+        Eigen::VectorXd depth;
+    };
+
+public:
+    /**
+     * \brief Creates a PrefetchingFrameSource and starts the decoder threads
+     * \param data_set
+     * 			Dataset to replay
+     * \param downsampling_factor
+     * 			Resolution downsampling factor applied on decoding
+     * \param decoder_threads
+     * 			Number of concurrent decoder threads
+     * \param lookahead
+     * 			Maximum number of frames decoded ahead of the consumer. The
+     * 			frames are decoded in chunks of lookahead / decoder_threads
+     * 			frames.
+     * \param first_frame
+     * 			Index of the first dataset frame to deliver
+     * \param frame_count
+     * 			Maximum number of frames to deliver, 0 for all
+     */
+    PrefetchingFrameSource(const std::shared_ptr<TrackingDataset>& data_set,
+                           int downsampling_factor,
+                           int decoder_threads,
+                           int lookahead,
+                           size_t first_frame = 0,
+                           size_t frame_count = 0);
+
+    /**
+     * \brief Stops and joins all decoder threads
+     */
+    ~PrefetchingFrameSource();
+
+    /**
+     * \brief Blocks until the next frame in timestamp order is decoded.
+     * \return false if all frames have been delivered or the source has been
+     *         stopped
+     */
+    bool next(Frame& frame);
+
+    /**
+     * \brief Total number of frames this source delivers
+     */
+    size_t size() const;
+
+    /**
+     * \brief Stops decoding. Pending and subsequent calls of next() return
+     * false.
+     */
+    void stop();
+
+private:
+    void decode_loop();
+
+private:
+    std::shared_ptr<TrackingDataset> data_set_;
+    int downsampling_factor_;
+    size_t lookahead_;
+    size_t chunk_frames_;
+
+    /**
+     * \brief Dataset frame indices sorted by image timestamp
+     */
+    std::vector<size_t> order_;
+
+    /**
+     * \brief Position within order_ of the next chunk handed to a decoder
+     */
+    size_t next_to_decode_;
+
+    /**
+     * \brief Position within order_ of the next frame handed to the consumer
+     */
+    size_t next_to_deliver_;
+
+    /**
+     * \brief Reorder buffer of decoded frames keyed by their position
+     */
+    std::map<size_t, Frame> decoded_frames_;
+
+    bool stopped_;
+    std::mutex mutex_;
+    std::condition_variable frame_decoded_;
+    std::condition_variable frame_delivered_;
+    std::vector<std::thread> decoders_;
+};
+}
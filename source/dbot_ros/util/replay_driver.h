@@ -0,0 +1,139 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file replay_driver.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <dbot_ros/util/data_set_camera_data_provider.h>
+#include <dbot_ros/util/tracking_dataset.h>
+#include <functional>
+#include <memory>
+#include <sensor_msgs/Image.h>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Steps a tracker through the frames of a TrackingDataset without a
+ * ROS master.
+ *
+ * By default, frames are tracked back to back as fast as the tracker allows.
+ * With the simulated clock enabled, frames are released at their original
+ * inter-frame timing (optionally scaled). As in the live tracker, a frame
+ * which has been superseded by a newer one while the tracker was busy is
+ * skipped.
+ *
+ * The depth images are read and converted into observations by a
+ * PrefetchingFrameSource ahead of the tracker, such that the replay is
+ * limited by the filter rather than by the bag reader.
+ */
+template <typename Tracker>
+class ReplayDriver
+{
+public:
+    typedef typename Tracker::State State;
+    typedef typename Tracker::Obsrv Obsrv;
+
+    /**
+     * \brief Invoked after each tracked frame with the dataset frame index,
+     *        the frame's image and the estimated state
+     */
+    typedef std::function<void(
+        size_t, const sensor_msgs::Image&, const State&)> Callback;
+
+    struct Parameters
+    {
+        Parameters()
+            : simulated_clock(false),
+              clock_rate(1.0),
+              first_frame(0),
+              frame_count(0),
+              decoder_threads(2),
+              lookahead(8)
+        {
+        }
+
+        /** \brief Release frames at their recorded time stamps */
+        bool simulated_clock;
+        /** \brief Speed of the simulated clock relative to the recording */
+        double clock_rate;
+        /** \brief Index of the first frame to track */
+        size_t first_frame;
+        /** \brief Maximum number of frames to replay, 0 for all */
+        size_t frame_count;
+        /** \brief Number of threads decoding the upcoming frames */
+        int decoder_threads;
+        /** \brief Maximum number of frames decoded ahead of the tracker */
+        int lookahead;
+    };
+
+public:
+    /**
+     * \brief Creates a ReplayDriver
+     * \param camera_data_provider
+     * 			Provider of the dataset the tracker's camera data has been
+     * 			created from. Its frame cursor is moved by the driver.
+     * \param object_count
+     * 			Number of tracked objects
+     */
+    ReplayDriver(const std::shared_ptr<Tracker>& tracker,
+                 const std::shared_ptr<TrackingDataset>& data_set,
+                 const std::shared_ptr<DataSetCameraDataProvider>&
+                     camera_data_provider,
+                 int object_count,
+                 const Parameters& params = Parameters());
+
+    /**
+     * \brief Initializes the tracker with the ground truth of the first
+     *        replayed frame.
+     *
+     * The ground truth vector has to contain either a PoseVector (6) or a
+     * PoseVelocityVector (12) per object.
+     *
+     * \return false if the frame has no valid ground truth
+     */
+    bool initialize_from_ground_truth();
+
+    void initialize(const std::vector<State>& initial_states);
+
+    /**
+     * \brief Replays the dataset
+     * \return number of tracked frames
+     */
+    size_t run(const Callback& callback = Callback());
+
+    /**
+     * \brief Number of frames skipped by the simulated clock during the last
+     *        run
+     */
+    size_t skipped_frames() const;
+
+    /**
+     * \brief Durations in seconds of the Tracker::track() calls of the last
+     *        run
+     */
+    const std::vector<double>& track_durations() const;
+
+private:
+    std::shared_ptr<Tracker> tracker_;
+    std::shared_ptr<TrackingDataset> data_set_;
+    std::shared_ptr<DataSetCameraDataProvider> camera_data_provider_;
+    int object_count_;
+    Parameters params_;
+    size_t skipped_frames_;
+    std::vector<double> track_durations_;
+};
+}
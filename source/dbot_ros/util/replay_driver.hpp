@@ -0,0 +1,181 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file replay_driver.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <dbot/pose/pose_vector.h>
+#include <dbot/pose/pose_velocity_vector.h>
+#include <dbot_ros/util/prefetching_frame_source.h>
+#include <dbot_ros/util/replay_driver.h>
+#include <thread>
+#include <utility>
+
+namespace dbot
+{
+template <typename Tracker>
+ReplayDriver<Tracker>::ReplayDriver(
+    const std::shared_ptr<Tracker>& tracker,
+    const std::shared_ptr<TrackingDataset>& data_set,
+    const std::shared_ptr<DataSetCameraDataProvider>& camera_data_provider,
+    int object_count,
+    const Parameters& params)
+    : tracker_(tracker),
+      data_set_(data_set),
+      camera_data_provider_(camera_data_provider),
+      object_count_(object_count),
+      params_(params),
+      skipped_frames_(0)
+{
+}
+
+template <typename Tracker>
+bool ReplayDriver<Tracker>::initialize_from_ground_truth()
+{
+    if (params_.first_frame >= data_set_->Size()) return false;
+
+    Eigen::VectorXd ground_truth =
+        data_set_->GetGroundTruth(params_.first_frame);
+
+    const int pose_size          = PoseVector::SizeAtCompileTime;
+    const int pose_velocity_size = PoseVelocityVector::SizeAtCompileTime;
+
+    int dimension = 0;
+    if (ground_truth.size() == object_count_ * pose_velocity_size)
+    {
+        dimension = pose_velocity_size;
+    }
+    else if (ground_truth.size() == object_count_ * pose_size)
+    {
+        dimension = pose_size;
+    }
+    else
+    {
+        ROS_ERROR("Frame %zu has no ground truth for %d objects",
+                  params_.first_frame,
+                  object_count_);
+        return false;
+    }
+
+    State state(object_count_);
+    for (int i = 0; i < object_count_; ++i)
+    {
+        PoseVelocityVector pose_velocity;
+        pose_velocity.setZero();
+        pose_velocity.head(dimension) =
+            ground_truth.segment(i * dimension, dimension);
+        state.component(i) = pose_velocity;
+    }
+
+    initialize({state});
+
+    return true;
+}
+
+template <typename Tracker>
+void ReplayDriver<Tracker>::initialize(const std::vector<State>& initial_states)
+{
+    tracker_->initialize(initial_states);
+}
+
+template <typename Tracker>
+size_t ReplayDriver<Tracker>::run(const Callback& callback)
+{
+    typedef std::chrono::steady_clock Clock;
+    typedef PrefetchingFrameSource::Frame Frame;
+
+    skipped_frames_ = 0;
+    track_durations_.clear();
+    if (params_.first_frame >= data_set_->Size()) return 0;
+
+    PrefetchingFrameSource frame_source(
+        data_set_,
+        camera_data_provider_->downsampling_factor(),
+        params_.decoder_threads,
+        params_.lookahead,
+        params_.first_frame,
+        params_.frame_count);
+    track_durations_.reserve(frame_source.size());
+
+    Frame frame;
+    Frame upcoming_frame;
+    if (!frame_source.next(frame)) return 0;
+    bool has_upcoming_frame = frame_source.next(upcoming_frame);
+
+    double first_stamp = frame.stamp.toSec();
+    auto start         = Clock::now();
+
+    // time of a frame on the simulated clock
+    auto release_time = [&](const Frame& f) {
+        double offset = (f.stamp.toSec() - first_stamp) / params_.clock_rate;
+        return start + std::chrono::duration_cast<Clock::duration>(
+                           std::chrono::duration<double>(offset));
+    };
+
+    size_t tracked_frames = 0;
+    while (true)
+    {
+        if (params_.simulated_clock)
+        {
+            // a live tracker would only see the newest frame after being busy
+            auto now = Clock::now();
+            while (has_upcoming_frame && release_time(upcoming_frame) <= now)
+            {
+                frame              = std::move(upcoming_frame);
+                has_upcoming_frame = frame_source.next(upcoming_frame);
+                ++skipped_frames_;
+            }
+
+            std::this_thread::sleep_until(release_time(frame));
+        }
+
+        // frames which failed to decode carry no depth and are skipped
+        if (frame.depth.size() > 0)
+        {
+            camera_data_provider_->frame(frame.index);
+            Obsrv obsrv = frame.depth.template cast<typename Obsrv::Scalar>();
+
+            auto track_start = Clock::now();
+            auto state       = tracker_->track(obsrv);
+            track_durations_.push_back(
+                std::chrono::duration<double>(Clock::now() - track_start)
+                    .count());
+            ++tracked_frames;
+
+            if (callback) callback(frame.index, *frame.image, state);
+        }
+
+        if (!has_upcoming_frame) break;
+        frame              = std::move(upcoming_frame);
+        has_upcoming_frame = frame_source.next(upcoming_frame);
+    }
+
+    return tracked_frames;
+}
+
+template <typename Tracker>
+size_t ReplayDriver<Tracker>::skipped_frames() const
+{
+    return skipped_frames_;
+}
+
+template <typename Tracker>
+const std::vector<double>& ReplayDriver<Tracker>::track_durations() const
+{
+    return track_durations_;
+}
+}
@@ -36,8 +36,7 @@ RosCameraDataProvider::RosCameraDataProvider(
       depth_image_topic_(depth_image_topic),
       native_resolution_(native_res),
       downsampling_factor_(downsampling_factor),
-      timeout_(timeout),
-      camera_matrix_(Eigen::MatrixXd::Zero(1, 1))
+      timeout_(timeout)
 {
 }
 
@@ -65,26 +64,35 @@ Eigen::VectorXd RosCameraDataProvider::depth_image_vector() const
 
 Eigen::Matrix3d RosCameraDataProvider::camera_matrix() const
 {
-    while (camera_matrix_.isZero())
-    {
-        camera_matrix_ =
-            ri::get_camera_matrix<double>(camera_info_topic_, nh_, timeout_);
-        camera_matrix_.topLeftCorner(2, 3) /= downsampling_factor_;
-    }
+    auto info = camera_info();
 
-    return camera_matrix_;
+    Eigen::Matrix3d camera_matrix;
+    for (size_t col = 0; col < 3; col++)
+        for (size_t row = 0; row < 3; row++)
+            camera_matrix(row, col) = info.K[col + row * 3];
+    camera_matrix.topLeftCorner(2, 3) /= downsampling_factor_;
+
+    return camera_matrix;
 }
 
 std::string RosCameraDataProvider::frame_id() const
 {
-    while (frame_id_.empty())
+    return camera_info().header.frame_id;
+}
+
+sensor_msgs::CameraInfo RosCameraDataProvider::camera_info() const
+{
+    std::lock_guard<std::mutex> lock(camera_info_mutex_);
+    while (!camera_info_)
     {
-        frame_id_ =
-            ri::get_camera_frame<double>(camera_info_topic_, nh_, timeout_);
-        ros::Duration(0.1).sleep();
+        if (!ros::ok()) return sensor_msgs::CameraInfo();
+
+        camera_info_ = ros::topic::waitForMessage<sensor_msgs::CameraInfo>(
+            camera_info_topic_, nh_, ros::Duration(timeout_));
+        if (!camera_info_) ROS_INFO("Waiting for camera info ...");
     }
 
-    return frame_id_;
+    return *camera_info_;
 }
 
 int RosCameraDataProvider::downsampling_factor() const
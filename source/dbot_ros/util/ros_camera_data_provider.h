@@ -21,7 +21,9 @@
 
 #include <Eigen/Dense>
 #include <dbot/camera_data_provider.h>
+#include <mutex>
 #include <ros/ros.h>
+#include <sensor_msgs/CameraInfo.h>
 #include <string>
 
 namespace dbot
@@ -71,6 +73,12 @@ public:
      */
     std::string frame_id() const;
 
+    /**
+     * \brief Returns the camera info the camera matrix and the camera frame
+     * are taken from. The camera info topic is only waited for once.
+     */
+    sensor_msgs::CameraInfo camera_info() const;
+
     /**
      * \brief Returns the downsampling_factor defined on construction
      */
@@ -85,8 +93,8 @@ private:
     mutable ros::NodeHandle nh_;
     std::string camera_info_topic_;
     std::string depth_image_topic_;
-    mutable std::string frame_id_;
-    mutable Eigen::MatrixXd camera_matrix_;
+    mutable std::mutex camera_info_mutex_;
+    mutable sensor_msgs::CameraInfo::ConstPtr camera_info_;
     CameraData::Resolution native_resolution_;
     int downsampling_factor_;
     double timeout_;
@@ -21,15 +21,15 @@
 #include <dbot_ros/util/ros_interface.h>
 #include <dbot_ros_msgs/ObjectState.h>
 
-void ri::publish_marker(const geometry_msgs::PoseStamped& pose_stamped,
-                        const std::string& object_model_path,
-                        const ros::Publisher& pub,
-                        const int& marker_id,
-                        const float& r,
-                        const float& g,
-                        const float& b,
-                        const float& a,
-                        const std::string& ns)
+visualization_msgs::Marker ri::make_marker(
+    const geometry_msgs::PoseStamped& pose_stamped,
+    const std::string& object_model_path,
+    const int& marker_id,
+    const float& r,
+    const float& g,
+    const float& b,
+    const float& a,
+    const std::string& ns)
 {
     visualization_msgs::Marker marker;
 
@@ -52,5 +52,19 @@ void ri::publish_marker(const geometry_msgs::PoseStamped& pose_stamped,
     marker.type   = visualization_msgs::Marker::MESH_RESOURCE;
     marker.action = visualization_msgs::Marker::ADD;
 
-    pub.publish(marker);
+    return marker;
+}
+
+void ri::publish_marker(const geometry_msgs::PoseStamped& pose_stamped,
+                        const std::string& object_model_path,
+                        const ros::Publisher& pub,
+                        const int& marker_id,
+                        const float& r,
+                        const float& g,
+                        const float& b,
+                        const float& a,
+                        const std::string& ns)
+{
+    pub.publish(make_marker(
+        pose_stamped, object_model_path, marker_id, r, g, b, a, ns));
 }
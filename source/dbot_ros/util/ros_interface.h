@@ -20,10 +20,12 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <cstdint>
 #include <geometry_msgs/PoseStamped.h>
 #include <geometry_msgs/Twist.h>
 #include <geometry_msgs/TwistStamped.h>
 #include <limits>
+#include <stdexcept>
 #include <ros/ros.h>
 #include <sensor_msgs/CameraInfo.h>
 #include <sensor_msgs/PointCloud2.h>
@@ -106,6 +108,29 @@ inline geometry_msgs::Pose to_ros_pose(
     return ros_pose;
 }
 
+/**
+ * \brief Nominal camera frame period [s], as assumed by the observation
+ * models
+ */
+const double default_frame_period = 1. / 30.;
+
+/**
+ * \brief Returns the duration [s] of the filter step from the image stamped
+ * \c previous to the one stamped \c current, or the nominal frame period if
+ * there is no previous image
+ */
+inline double step_duration(const ros::Time& previous, const ros::Time& current)
+{
+    if (previous.isZero() || current <= previous) return default_frame_period;
+
+    return (current - previous).toSec();
+}
+
+/**
+ * \brief Converts the velocities of \c pose_vector as estimated, i.e. as
+ * displacements per filter step [m] and [rad]. The dbot object transition
+ * models add the velocities to the pose once per filter step.
+ */
 inline geometry_msgs::Twist to_ros_velocity(
     const dbot::PoseVelocityVector& pose_vector)
 {
@@ -123,6 +148,60 @@ inline geometry_msgs::Twist to_ros_velocity(
     return ros_velocity;
 }
 
+/**
+ * \brief Converts the per filter step velocities \c step_velocity into
+ * [m/s] and [rad/s] given the duration of the filter step
+ * \c step_duration [s]
+ */
+inline geometry_msgs::Twist to_ros_velocity(
+    const geometry_msgs::Twist& step_velocity,
+    double step_duration)
+{
+    geometry_msgs::Twist ros_velocity;
+    ros_velocity.linear.x  = step_velocity.linear.x / step_duration;
+    ros_velocity.linear.y  = step_velocity.linear.y / step_duration;
+    ros_velocity.linear.z  = step_velocity.linear.z / step_duration;
+    ros_velocity.angular.x = step_velocity.angular.x / step_duration;
+    ros_velocity.angular.y = step_velocity.angular.y / step_duration;
+    ros_velocity.angular.z = step_velocity.angular.z / step_duration;
+
+    return ros_velocity;
+}
+
+/**
+ * \brief Predicts the pose \c dt seconds ahead assuming constant linear
+ * [m/s] and angular [rad/s] velocities, see to_ros_velocity(step_velocity,
+ * step_duration)
+ */
+inline geometry_msgs::Pose extrapolate(const geometry_msgs::Pose& pose,
+                                       const geometry_msgs::Twist& velocity,
+                                       double dt)
+{
+    Eigen::Vector3d w(
+        velocity.angular.x, velocity.angular.y, velocity.angular.z);
+    Eigen::Quaterniond q(pose.orientation.w,
+                         pose.orientation.x,
+                         pose.orientation.y,
+                         pose.orientation.z);
+    double angle = w.norm() * dt;
+    if (angle > 0.0)
+    {
+        q = Eigen::Quaterniond(Eigen::AngleAxisd(angle, w.normalized())) * q;
+        q.normalize();
+    }
+
+    geometry_msgs::Pose predicted;
+    predicted.position.x    = pose.position.x + velocity.linear.x * dt;
+    predicted.position.y    = pose.position.y + velocity.linear.y * dt;
+    predicted.position.z    = pose.position.z + velocity.linear.z * dt;
+    predicted.orientation.w = q.w();
+    predicted.orientation.x = q.x();
+    predicted.orientation.y = q.y();
+    predicted.orientation.z = q.z();
+
+    return predicted;
+}
+
 inline geometry_msgs::Pose to_ros_pose(const Eigen::Matrix3d& R,
                                        const Eigen::Vector3d& t)
 {
@@ -132,19 +211,36 @@ inline geometry_msgs::Pose to_ros_pose(const Eigen::Matrix3d& R,
     return to_ros_pose(pose_vector);
 }
 
+/**
+ * \brief Returns the depth in meters at (row, col) of a 32FC1 or, if
+ * \c millimeters is set, of a 16UC1 depth image. 16UC1 depths are given in
+ * millimeters and zero denotes a missing measurement.
+ */
+inline float depth_at(const cv::Mat& image, bool millimeters, int row, int col)
+{
+    if (!millimeters) return image.at<float>(row, col);
+
+    uint16_t depth = image.at<uint16_t>(row, col);
+    return depth == 0 ? std::numeric_limits<float>::quiet_NaN()
+                      : depth * 0.001f;
+}
+
 template <typename Scalar>
 Eigen::Matrix<Scalar, -1, -1> to_eigen_matrix(
     const sensor_msgs::Image& ros_image, const size_t& n_downsampling = 1)
 {
     cv::Mat cv_image = cv_bridge::toCvCopy(ros_image)->image;
+    bool millimeters = ros_image.encoding == "16UC1";
 
     size_t n_rows = cv_image.rows / n_downsampling;
     size_t n_cols = cv_image.cols / n_downsampling;
     Eigen::Matrix<Scalar, -1, -1> eigen_image(n_rows, n_cols);
     for (size_t row = 0; row < n_rows; row++)
         for (size_t col = 0; col < n_cols; col++)
-            eigen_image(row, col) =
-                cv_image.at<float>(row * n_downsampling, col * n_downsampling);
+            eigen_image(row, col) = depth_at(cv_image,
+                                             millimeters,
+                                             row * n_downsampling,
+                                             col * n_downsampling);
 
     return eigen_image;
 }
@@ -154,6 +250,7 @@ Eigen::Matrix<Scalar, -1, 1> to_eigen_vector(
     const sensor_msgs::Image& ros_image, const size_t& n_downsampling = 1)
 {
     cv::Mat cv_image = cv_bridge::toCvCopy(ros_image)->image;
+    bool millimeters = ros_image.encoding == "16UC1";
 
     size_t n_rows = cv_image.rows / n_downsampling;
     size_t n_cols = cv_image.cols / n_downsampling;
@@ -161,8 +258,10 @@ Eigen::Matrix<Scalar, -1, 1> to_eigen_vector(
     Eigen::Matrix<Scalar, -1, 1> eigen_image(n_rows * n_cols, 1);
     for (size_t row = 0; row < n_rows; row++)
         for (size_t col = 0; col < n_cols; col++)
-            eigen_image(row * n_cols + col) =
-                cv_image.at<float>(row * n_downsampling, col * n_downsampling);
+            eigen_image(row * n_cols + col) = depth_at(cv_image,
+                                                       millimeters,
+                                                       row * n_downsampling,
+                                                       col * n_downsampling);
 
     return eigen_image;
 }
@@ -183,6 +282,23 @@ struct CastFromRos
     static T f(XmlRpc::XmlRpcValue ros_parameter) { return T(ros_parameter); }
 };
 
+/**
+ * \brief Integral values such as 1 in a yaml file are stored as int and are
+ * accepted for double parameters
+ */
+template <>
+struct CastFromRos<double>
+{
+    static double f(XmlRpc::XmlRpcValue ros_parameter)
+    {
+        if (ros_parameter.getType() == XmlRpc::XmlRpcValue::TypeInt)
+        {
+            return int(ros_parameter);
+        }
+        return double(ros_parameter);
+    }
+};
+
 template <typename T>
 struct CastFromRos<std::vector<T>>
 {
@@ -214,6 +330,11 @@ struct CastFromRos<std::map<std::string, T>>
     }
 };
 
+/**
+ * \brief Reads the parameter at \c path
+ * \throws std::runtime_error if the parameter does not exist or its type does
+ *         not match
+ */
 template <typename Parameter>
 Parameter read(const std::string& path, ros::NodeHandle node_handle)
 {
@@ -221,11 +342,20 @@ Parameter read(const std::string& path, ros::NodeHandle node_handle)
 
     if (!node_handle.getParam(path, ros_parameter))
     {
-        ROS_ERROR_STREAM("Could not read parameter at " << path);
-        throw;
+        throw std::runtime_error("Could not read parameter at " +
+                                 node_handle.resolveName(path));
     }
 
-    return cast_from_ros<Parameter>(ros_parameter);
+    try
+    {
+        return cast_from_ros<Parameter>(ros_parameter);
+    }
+    catch (XmlRpc::XmlRpcException& e)
+    {
+        throw std::runtime_error("Parameter at " +
+                                 node_handle.resolveName(path) +
+                                 " has an unexpected type");
+    }
 }
 
 
@@ -280,6 +410,19 @@ std::string get_camera_frame(const std::string& camera_info_topic,
     return camera_info->header.frame_id;
 }
 
+/**
+ * \brief Creates a mesh resource marker of the object model at the given pose
+ */
+visualization_msgs::Marker make_marker(
+    const geometry_msgs::PoseStamped& pose_stamped,
+    const std::string& object_model_path,
+    const int& marker_id  = 0,
+    const float& r        = 0,
+    const float& g        = 0,
+    const float& b        = 1,
+    const float& a        = 1.0,
+    const std::string& ns = "object");
+
 void publish_marker(const geometry_msgs::PoseStamped& pose_stamped,
                     const std::string& object_model_path,
                     const ros::Publisher& pub,
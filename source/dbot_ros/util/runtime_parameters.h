@@ -0,0 +1,143 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file runtime_parameters.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Parameters of the optional tracker node features, see runtime.yaml. They
+ * are kept apart from the features themselves, such that the configuration
+ * does not pull in their message and threading headers.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace dbot
+{
+/**
+ * \brief Parameters of the ObjectStatePublisher
+ */
+struct ObjectStatePublisherParameters
+{
+    ObjectStatePublisherParameters()
+        : per_object(true),
+          batched(false),
+          marker_rate(0.0),
+          deadband_translation(0.0),
+          deadband_rotation(0.0),
+          keep_alive_rate(1.0),
+          latency_compensation(false),
+          tf(false)
+    {
+    }
+
+    /// publishes an ObjectState on object_state and a Marker on
+    /// object_model for each object
+    bool per_object;
+    /// publishes a single ObjectStateArray on object_states and a single
+    /// MarkerArray on object_models per frame
+    bool batched;
+    /// maximum rate of the object model markers [Hz], 0 publishes them
+    /// with every frame. Markers are only published while subscribed
+    double marker_rate;
+    /// deadband: an object state is only published if its position
+    /// changed by more than deadband_translation [m] or its orientation
+    /// by more than deadband_rotation [rad] since it was last published.
+    /// 0 for both disables the deadband, 0 for one of them publishes any
+    /// change along that axis
+    double deadband_translation;
+    double deadband_rotation;
+    /// minimum rate [Hz] at which unchanged states are published within
+    /// the deadband
+    double keep_alive_rate;
+    /// predicts the estimates to the time of publishing using the
+    /// estimated velocities and stamps them accordingly. The batched
+    /// array reports the compensated interval as extrapolation
+    bool latency_compensation;
+    /// broadcasts all object poses of a frame in a single tfMessage. The
+    /// object frames are named tf_prefix + mesh name, suffixed by the
+    /// object index if a mesh is tracked more than once
+    bool tf;
+    std::string tf_prefix;
+};
+
+/**
+ * \brief Parameters of the PredictedStatePublisher
+ */
+struct PredictedStatePublisherParameters
+{
+    PredictedStatePublisherParameters() : rate(200.0), max_extrapolation(0.1)
+    {
+    }
+
+    /// publishing rate [Hz]
+    double rate;
+    /// estimates older than this [s] are not extrapolated, i.e. no
+    /// predictions are published until the next estimate arrives
+    double max_extrapolation;
+};
+
+/**
+ * \brief Parameters of the BeliefCheckpoint
+ */
+struct BeliefCheckpointParameters
+{
+    BeliefCheckpointParameters()
+        : path("/tmp/dbot_belief_checkpoint"), rate(2.0), max_age(10.0)
+    {
+    }
+
+    /// checkpoint file
+    std::string path;
+    /// checkpoint rate [Hz]
+    double rate;
+    /// checkpoints older than this [s] are not resumed from. Zero
+    /// accepts checkpoints of any age
+    double max_age;
+};
+
+/**
+ * \brief Parameters of the FlightRecorder
+ */
+struct FlightRecorderParameters
+{
+    FlightRecorderParameters()
+        : path("/tmp"),
+          duration(10.0),
+          rate(30.0),
+          max_latency(0.0),
+          max_translation_jump(0.0),
+          max_rotation_jump(0.0),
+          trigger_cooldown(30.0)
+    {
+    }
+
+    /** \brief Directory below which the dumps are created */
+    std::string path;
+    /** \brief Recorded time span in seconds */
+    double duration;
+    /** \brief Expected frame rate used to size the ring buffer */
+    double rate;
+    /** \brief Latency in seconds triggering a dump, 0 to disable */
+    double max_latency;
+    /** \brief Translation in m between frames triggering a dump, 0 to
+     * disable */
+    double max_translation_jump;
+    /** \brief Rotation in rad between frames triggering a dump, 0 to
+     * disable */
+    double max_rotation_jump;
+    /** \brief Minimum time in seconds between two automatic dumps */
+    double trigger_cooldown;
+};
+}
@@ -0,0 +1,117 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file session_recorder.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cerrno>
+#include <dbot_ros/util/session_recorder.h>
+#include <ros/ros.h>
+
+namespace dbot
+{
+SessionRecorder::SessionRecorder(const boost::filesystem::path& path,
+                                 const sensor_msgs::CameraInfo& camera_info,
+                                 size_t queue_size)
+    : writer_(path, camera_info),
+      queue_(queue_size),
+      running_(true),
+      recorded_frames_(0),
+      dropped_frames_(0)
+{
+    sem_init(&pending_frames_, 0, 0);
+
+    if (writer_.is_open())
+    {
+        ROS_INFO("Recording session to %s", path.string().c_str());
+    }
+
+    writer_thread_ = std::thread(&SessionRecorder::write_loop, this);
+}
+
+SessionRecorder::~SessionRecorder()
+{
+    running_ = false;
+    sem_post(&pending_frames_);
+    if (writer_thread_.joinable()) writer_thread_.join();
+    writer_.close();
+    sem_destroy(&pending_frames_);
+
+    ROS_INFO("Session recording finished: %zu frames recorded, %zu dropped",
+             recorded_frames(),
+             dropped_frames());
+}
+
+bool SessionRecorder::record(
+    const sensor_msgs::Image& image,
+    const std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    Frame* frame = queue_.back();
+
+    if (!frame || !writer_.is_open())
+    {
+        ++dropped_frames_;
+        return false;
+    }
+
+    // assignment reuses the buffers of the preallocated slot
+    frame->image  = image;
+    frame->states = states;
+    queue_.push();
+
+    // wakes the writer thread without taking a lock
+    sem_post(&pending_frames_);
+
+    return true;
+}
+
+size_t SessionRecorder::recorded_frames() const
+{
+    return recorded_frames_;
+}
+
+size_t SessionRecorder::dropped_frames() const
+{
+    return dropped_frames_;
+}
+
+void SessionRecorder::write_loop()
+{
+    while (true)
+    {
+        if (sem_wait(&pending_frames_) != 0 && errno == EINTR) continue;
+
+        Frame* frame = queue_.front();
+
+        if (!frame)
+        {
+            // every frame is posted once, hence the queue has been drained
+            // when woken up for terminating with an empty queue
+            if (!running_) break;
+            continue;
+        }
+
+        if (writer_.write(frame->image, frame->states))
+        {
+            ++recorded_frames_;
+        }
+        else
+        {
+            ++dropped_frames_;
+        }
+
+        queue_.pop();
+    }
+}
+}
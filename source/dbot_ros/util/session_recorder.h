@@ -0,0 +1,96 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file session_recorder.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <dbot_ros/util/session_writer.h>
+#include <dbot_ros/util/spsc_queue.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <semaphore.h>
+#include <sensor_msgs/CameraInfo.h>
+#include <sensor_msgs/Image.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Records live tracking inputs and outputs without blocking the
+ * tracking thread.
+ *
+ * Frames are handed over through a bounded lock-free queue to a writer thread
+ * which appends them to a SessionWriter. If the queue is full, e.g. because
+ * the disk cannot keep up, frames are dropped and counted instead. The writer
+ * thread sleeps on a semaphore which is posted for every enqueued frame.
+ */
+class SessionRecorder
+{
+public:
+    /**
+     * \brief Creates a SessionRecorder and starts the writer thread
+     * \param path
+     * 			Session directory, see SessionWriter
+     * \param camera_info
+     * 			Camera info recorded along with every image
+     * \param queue_size
+     * 			Maximum number of frames pending to be written
+     */
+    SessionRecorder(const boost::filesystem::path& path,
+                    const sensor_msgs::CameraInfo& camera_info,
+                    size_t queue_size);
+
+    /**
+     * \brief Writes all pending frames and stops the writer thread
+     */
+    ~SessionRecorder();
+
+    /**
+     * \brief Enqueues a frame for recording. Never blocks.
+     * \return false if the frame has been dropped
+     */
+    bool record(const sensor_msgs::Image& image,
+                const std::vector<dbot_ros_msgs::ObjectState>& states);
+
+    size_t recorded_frames() const;
+    size_t dropped_frames() const;
+
+private:
+    struct Frame
+    {
+        sensor_msgs::Image image;
+        std::vector<dbot_ros_msgs::ObjectState> states;
+    };
+
+    void write_loop();
+
+private:
+    SessionWriter writer_;
+    SpscQueue<Frame> queue_;
+    std::atomic<bool> running_;
+    std::atomic<size_t> recorded_frames_;
+    std::atomic<size_t> dropped_frames_;
+
+    /**
+     * \brief Counts the frames enqueued but not yet taken by the writer
+     * thread, plus one post on termination
+     */
+    sem_t pending_frames_;
+    std::thread writer_thread_;
+};
+}
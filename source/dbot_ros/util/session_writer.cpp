@@ -0,0 +1,156 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file session_writer.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <ctime>
+#include <dbot_ros/util/ros_interface.h>
+#include <dbot_ros/util/session_writer.h>
+#include <ros/ros.h>
+#include <rosbag/bag.h>
+
+namespace dbot
+{
+SessionWriter::SessionWriter(const boost::filesystem::path& path,
+                             const sensor_msgs::CameraInfo& camera_info)
+    : path_(path), camera_info_(camera_info)
+{
+    try
+    {
+        boost::filesystem::create_directories(path_);
+
+        if (boost::filesystem::exists(path_ / "measurements.bag"))
+        {
+            ROS_ERROR("Session %s already exists, will not overwrite.",
+                      path_.string().c_str());
+            return;
+        }
+
+        bag_ = std::make_shared<rosbag::Bag>();
+        bag_->open((path_ / "measurements.bag").string(),
+                   rosbag::bagmode::Write);
+    }
+    catch (std::exception& e)
+    {
+        ROS_ERROR("Cannot create session %s: %s",
+                  path_.string().c_str(),
+                  e.what());
+        bag_.reset();
+    }
+}
+
+SessionWriter::~SessionWriter()
+{
+    close();
+}
+
+bool SessionWriter::is_open() const
+{
+    return bag_ != nullptr;
+}
+
+bool SessionWriter::write(const sensor_msgs::Image& image,
+                          const std::vector<dbot_ros_msgs::ObjectState>& states)
+{
+    if (!bag_) return false;
+
+    // the result layout is determined by the first frame
+    if (!result_writer_)
+    {
+        result_writer_ = std::make_shared<TrackingResultWriter>(
+            (path_ / "results.bin").string(),
+            TrackingResultLayout::object_states(states.size()));
+
+        // same layout as written by TrackingDataset::Store()
+        const uint32_t pose_size = dbot::PoseVector::SizeAtCompileTime;
+        ground_truth_writer_     = std::make_shared<TrackingResultWriter>(
+            (path_ / "ground_truth.bin").string(),
+            TrackingResultLayout(states.size(), pose_size, 0, 0));
+        ground_truth_.values.resize(pose_size * states.size());
+    }
+
+    // TrackingDataset pairs images and camera info by exact time stamps
+    camera_info_.header.stamp    = image.header.stamp;
+    camera_info_.header.frame_id = image.header.frame_id;
+
+    try
+    {
+        bag_->write("XTION/depth/image", image.header.stamp, image);
+        bag_->write(
+            "XTION/depth/camera_info", image.header.stamp, camera_info_);
+        for (auto& state : states)
+        {
+            bag_->write("object_state", image.header.stamp, state);
+        }
+    }
+    catch (std::exception& e)
+    {
+        ROS_ERROR("Writing session %s failed: %s",
+                  path_.string().c_str(),
+                  e.what());
+        return false;
+    }
+
+    const int pose_size = dbot::PoseVector::SizeAtCompileTime;
+    ground_truth_.stamp = image.header.stamp.toSec();
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        ground_truth_.values.segment(i * pose_size, pose_size) =
+            ri::to_pose_vector(states[i].pose.pose);
+    }
+
+    return result_writer_->write(states) &&
+           ground_truth_writer_->write(ground_truth_);
+}
+
+void SessionWriter::close()
+{
+    if (bag_)
+    {
+        bag_->close();
+        bag_.reset();
+    }
+
+    if (result_writer_)
+    {
+        if (!result_writer_->close() || !ground_truth_writer_->close())
+        {
+            ROS_ERROR("Writing session %s failed", path_.string().c_str());
+        }
+        result_writer_.reset();
+        ground_truth_writer_.reset();
+    }
+}
+
+boost::filesystem::path SessionWriter::unique_directory(
+    const boost::filesystem::path& base_path, const std::string& prefix)
+{
+    char time_string[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(time_string,
+                  sizeof(time_string),
+                  "%Y%m%d_%H%M%S",
+                  std::localtime(&now));
+
+    auto path = base_path / (prefix + "_" + time_string);
+    for (int i = 1; boost::filesystem::exists(path); ++i)
+    {
+        path = base_path /
+               (prefix + "_" + time_string + "_" + std::to_string(i));
+    }
+
+    return path;
+}
+}
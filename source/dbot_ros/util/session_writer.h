@@ -0,0 +1,91 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file session_writer.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <memory>
+#include <sensor_msgs/CameraInfo.h>
+#include <sensor_msgs/Image.h>
+#include <string>
+#include <vector>
+
+namespace rosbag
+{
+class Bag;
+}
+
+namespace dbot
+{
+/**
+ * \brief Writes tracking inputs and outputs into a session directory.
+ *
+ * The directory layout is compatible with TrackingDataset, i.e. the depth
+ * images and camera info messages are written into measurements.bag using the
+ * dataset topics. The object states are additionally stored in the same bag
+ * file under the topic object_state and in the binary file results.bin.
+ *
+ * The estimated poses are also written as ground truth (ground_truth.bin, one
+ * PoseVector per object), such that a replay of the session is initialized
+ * from the recorded estimate and later estimates are compared against the
+ * recorded ones.
+ */
+class SessionWriter
+{
+public:
+    /**
+     * \brief Creates the session directory \c path and opens the files
+     * \param camera_info
+     * 			Camera info written along with every image
+     */
+    SessionWriter(const boost::filesystem::path& path,
+                  const sensor_msgs::CameraInfo& camera_info);
+
+    ~SessionWriter();
+
+    bool is_open() const;
+
+    /**
+     * \brief Writes a frame and its estimated object states
+     */
+    bool write(const sensor_msgs::Image& image,
+               const std::vector<dbot_ros_msgs::ObjectState>& states);
+
+    /**
+     * \brief Flushes and closes all files
+     */
+    void close();
+
+    /**
+     * \brief Returns a not yet existing directory below \c base_path named
+     * after \c prefix and the current wall time
+     */
+    static boost::filesystem::path unique_directory(
+        const boost::filesystem::path& base_path,
+        const std::string& prefix);
+
+private:
+    boost::filesystem::path path_;
+    sensor_msgs::CameraInfo camera_info_;
+    std::shared_ptr<rosbag::Bag> bag_;
+    std::shared_ptr<TrackingResultWriter> result_writer_;
+    std::shared_ptr<TrackingResultWriter> ground_truth_writer_;
+    TrackingResultRecord ground_truth_;
+};
+}
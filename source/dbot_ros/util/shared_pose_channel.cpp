@@ -0,0 +1,277 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file shared_pose_channel.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dbot_ros/util/shared_pose_channel.h>
+#include <fcntl.h>
+#include <iostream>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dbot
+{
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+              "the sequence must be a plain 64 bit word in shared memory");
+
+/**
+ * \brief Returns whether the existing segment \c name has been left behind
+ * by a pose channel writer which is no longer running
+ */
+static bool is_stale(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return errno == ENOENT;
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 ||
+        size_t(status.st_size) < SharedPoseSegment::size(1))
+    {
+        close(fd);
+        return false;
+    }
+
+    void* memory =
+        mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) return false;
+
+    auto segment = static_cast<const SharedPoseSegment*>(memory);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    bool stale = segment->magic == SharedPoseSegment::magic_number &&
+                 segment->layout_version == SharedPoseSegment::version &&
+                 segment->owner_pid > 0 &&
+                 kill(segment->owner_pid, 0) != 0 && errno == ESRCH;
+    munmap(memory, status.st_size);
+
+    return stale;
+}
+
+std::string SharedPoseChannelWriter::default_name(const std::string& node_name)
+{
+    std::string name = "/dbot_poses" + node_name;
+    std::replace(name.begin() + 1, name.end(), '/', '_');
+    return name;
+}
+
+SharedPoseChannelWriter::SharedPoseChannelWriter(const std::string& name,
+                                                 uint32_t max_objects)
+    : name_(name),
+      segment_(nullptr),
+      size_(SharedPoseSegment::size(std::max(max_objects, 1u))),
+      device_(0),
+      inode_(0)
+{
+    // the segment is always created afresh, i.e. an existing one is never
+    // resized while a reader may have it mapped
+    int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST)
+    {
+        // only a segment left behind by a crashed writer is replaced. A
+        // running writer keeps its segment
+        if (!is_stale(name_))
+        {
+            std::cerr << "Shared memory " << name_
+                      << " exists and is not left behind by a crashed pose "
+                         "channel writer. Remove /dev/shm" << name_
+                      << " if it is not in use." << std::endl;
+            return;
+        }
+
+        std::cerr << "Replacing stale shared memory " << name_ << std::endl;
+        shm_unlink(name_.c_str());
+        fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0)
+    {
+        std::cerr << "Cannot create shared memory " << name_ << ": "
+                  << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 || ftruncate(fd, size_) != 0)
+    {
+        std::cerr << "Cannot resize shared memory " << name_ << ": "
+                  << std::strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(name_.c_str());
+        return;
+    }
+    device_ = status.st_dev;
+    inode_  = status.st_ino;
+
+    void* memory =
+        mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        std::cerr << "Cannot map shared memory " << name_ << ": "
+                  << std::strerror(errno) << std::endl;
+        shm_unlink(name_.c_str());
+        return;
+    }
+
+    segment_ = static_cast<SharedPoseSegment*>(memory);
+    std::memset(memory, 0, size_);
+    segment_->max_objects    = std::max(max_objects, 1u);
+    segment_->layout_version = SharedPoseSegment::version;
+    segment_->owner_pid      = getpid();
+    segment_->sequence.store(0, std::memory_order_relaxed);
+
+    // readers check the magic number last
+    std::atomic_thread_fence(std::memory_order_release);
+    segment_->magic = SharedPoseSegment::magic_number;
+}
+
+SharedPoseChannelWriter::~SharedPoseChannelWriter()
+{
+    if (!segment_) return;
+
+    munmap(segment_, size_);
+
+    // the name is only removed if it still refers to this segment, i.e. it
+    // has not been replaced by another writer meanwhile
+    int fd = shm_open(name_.c_str(), O_RDONLY, 0);
+    if (fd < 0) return;
+
+    struct stat status;
+    bool owned = fstat(fd, &status) == 0 && status.st_dev == device_ &&
+                 status.st_ino == inode_;
+    close(fd);
+    if (owned) shm_unlink(name_.c_str());
+}
+
+bool SharedPoseChannelWriter::is_open() const
+{
+    return segment_ != nullptr;
+}
+
+void SharedPoseChannelWriter::write(int64_t stamp,
+                                    const std::vector<SharedPose>& poses)
+{
+    if (!segment_) return;
+
+    uint32_t count = std::min<uint32_t>(poses.size(), segment_->max_objects);
+
+    // odd sequence: write in progress
+    uint64_t sequence = segment_->sequence.load(std::memory_order_relaxed);
+    segment_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    segment_->stamp        = stamp;
+    segment_->object_count = count;
+    std::memcpy(segment_->objects, poses.data(), count * sizeof(SharedPose));
+
+    segment_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+SharedPoseChannelReader::SharedPoseChannelReader(const std::string& name)
+    : segment_(nullptr), size_(0)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        std::cerr << "Cannot open shared memory " << name << ": "
+                  << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 ||
+        size_t(status.st_size) < SharedPoseSegment::size(1))
+    {
+        std::cerr << "Shared memory " << name << " is not a pose channel"
+                  << std::endl;
+        close(fd);
+        return;
+    }
+
+    size_ = status.st_size;
+    void* memory = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        std::cerr << "Cannot map shared memory " << name << ": "
+                  << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    segment_ = static_cast<const SharedPoseSegment*>(memory);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (segment_->magic != SharedPoseSegment::magic_number ||
+        segment_->layout_version != SharedPoseSegment::version ||
+        SharedPoseSegment::size(segment_->max_objects) > size_)
+    {
+        std::cerr << "Shared memory " << name
+                  << " is not a compatible pose channel" << std::endl;
+        munmap(const_cast<SharedPoseSegment*>(segment_), size_);
+        segment_ = nullptr;
+    }
+}
+
+SharedPoseChannelReader::~SharedPoseChannelReader()
+{
+    if (segment_) munmap(const_cast<SharedPoseSegment*>(segment_), size_);
+}
+
+bool SharedPoseChannelReader::is_open() const
+{
+    return segment_ != nullptr;
+}
+
+uint64_t SharedPoseChannelReader::sequence() const
+{
+    return segment_ ? segment_->sequence.load(std::memory_order_acquire) : 0;
+}
+
+bool SharedPoseChannelReader::read(int64_t& stamp,
+                                   std::vector<SharedPose>& poses,
+                                   uint64_t* sequence,
+                                   int max_retries) const
+{
+    if (!segment_) return false;
+
+    poses.reserve(segment_->max_objects);
+    for (int i = 0; i < max_retries; ++i)
+    {
+        uint64_t before = segment_->sequence.load(std::memory_order_acquire);
+        if (before == 0) return false;
+        if (before & 1) continue;
+
+        uint32_t count = std::min(segment_->object_count,
+                                  segment_->max_objects);
+        stamp = segment_->stamp;
+        poses.resize(count);
+        std::memcpy(
+            poses.data(), segment_->objects, count * sizeof(SharedPose));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = segment_->sequence.load(std::memory_order_relaxed);
+        if (before == after)
+        {
+            if (sequence) *sequence = after;
+            return true;
+        }
+    }
+
+    return false;
+}
+}
@@ -0,0 +1,152 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file shared_pose_channel.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Latest object poses in POSIX shared memory for consumers on the same host.
+ * This header does not depend on ROS. Consumers link against the
+ * dbot_ros_shared_pose_channel library only.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Pose and velocity of a single object in the camera frame. As on
+ * object_state, the velocities are the displacements per filter step
+ */
+struct SharedPose
+{
+    double position[3];          ///< x, y, z [m]
+    double orientation[4];       ///< quaternion w, x, y, z
+    double linear_velocity[3];   ///< [m] per filter step
+    double angular_velocity[3];  ///< [rad] per filter step
+};
+
+/**
+ * \brief Layout of the shared memory segment.
+ *
+ * The segment is guarded by a sequence lock. The writer increments
+ * \c sequence before and after updating the snapshot, i.e. the sequence is
+ * odd while a write is in progress. A reader copies the snapshot and retries
+ * if the sequence was odd or changed meanwhile. Readers never block the
+ * writer.
+ */
+struct SharedPoseSegment
+{
+    static constexpr uint32_t magic_number = 0x44425053;  // "DBPS"
+    static constexpr uint32_t version      = 2;
+
+    uint32_t magic;
+    uint32_t layout_version;
+    uint32_t max_objects;
+    uint32_t object_count;
+    int32_t owner_pid;  ///< process id of the writer
+    uint32_t reserved;
+    std::atomic<uint64_t> sequence;
+    int64_t stamp;  ///< image stamp of the estimate [ns]
+    SharedPose objects[1];
+
+    static size_t size(uint32_t max_objects)
+    {
+        return offsetof(SharedPoseSegment, objects) +
+               sizeof(SharedPose) * max_objects;
+    }
+};
+
+/**
+ * \brief Creates the shared memory segment \c name (e.g.
+ * "/dbot_poses_particle_tracker") and publishes pose snapshots into it.
+ *
+ * The writer owns the segment. If a segment of the same name exists, it is
+ * only replaced if it was left behind by a writer which is no longer
+ * running, i.e. its owner process id is dead. Otherwise, including segments
+ * which are not pose channels or predate the owner id, the writer fails to
+ * open. The segment is removed on destruction unless it has been replaced
+ * meanwhile.
+ */
+class SharedPoseChannelWriter
+{
+public:
+    /**
+     * \brief Returns the default segment name of the tracker node
+     *        \c node_name, i.e. "/dbot_poses" followed by the node name with
+     *        '/' replaced by '_'
+     */
+    static std::string default_name(const std::string& node_name);
+
+    SharedPoseChannelWriter(const std::string& name, uint32_t max_objects);
+    ~SharedPoseChannelWriter();
+
+    SharedPoseChannelWriter(const SharedPoseChannelWriter&) = delete;
+    SharedPoseChannelWriter& operator=(const SharedPoseChannelWriter&) = delete;
+
+    bool is_open() const;
+
+    /**
+     * \brief Replaces the snapshot. Poses beyond max_objects are ignored.
+     */
+    void write(int64_t stamp, const std::vector<SharedPose>& poses);
+
+private:
+    std::string name_;
+    SharedPoseSegment* segment_;
+    size_t size_;
+    uint64_t device_;
+    uint64_t inode_;
+};
+
+/**
+ * \brief Opens an existing shared pose segment for reading
+ */
+class SharedPoseChannelReader
+{
+public:
+    explicit SharedPoseChannelReader(const std::string& name);
+    ~SharedPoseChannelReader();
+
+    SharedPoseChannelReader(const SharedPoseChannelReader&) = delete;
+    SharedPoseChannelReader& operator=(const SharedPoseChannelReader&) = delete;
+
+    bool is_open() const;
+
+    /**
+     * \brief Sequence number of the latest snapshot. It increases by two with
+     *        every write, i.e. a changed sequence indicates a new snapshot.
+     */
+    uint64_t sequence() const;
+
+    /**
+     * \brief Copies a consistent snapshot
+     * \return false if the segment is not open, nothing has been written
+     *         yet, or no consistent snapshot was obtained within
+     *         \c max_retries attempts
+     */
+    bool read(int64_t& stamp,
+              std::vector<SharedPose>& poses,
+              uint64_t* sequence = nullptr,
+              int max_retries    = 1000) const;
+
+private:
+    const SharedPoseSegment* segment_;
+    size_t size_;
+};
+}
@@ -0,0 +1,101 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file spsc_queue.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Bounded lock-free single-producer single-consumer queue.
+ *
+ * All slots are allocated on construction. Elements are filled and consumed
+ * in place, i.e. the producer obtains the next free slot via back(), assigns
+ * it and publishes it via push(). This way slot members which own memory,
+ * such as image buffers, keep their capacity and are reused after warm-up.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    /**
+     * \brief Creates a queue holding at most \c capacity elements
+     */
+    explicit SpscQueue(size_t capacity)
+        : slots_(capacity + 1), head_(0), tail_(0)
+    {
+    }
+
+    /**
+     * \brief Returns the next free slot or nullptr if the queue is full.
+     * Must only be called by the producer.
+     */
+    T* back()
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (increment(tail) == head_.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return &slots_[tail];
+    }
+
+    /**
+     * \brief Publishes the slot obtained by back() to the consumer
+     */
+    void push()
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        tail_.store(increment(tail), std::memory_order_release);
+    }
+
+    /**
+     * \brief Returns the oldest element or nullptr if the queue is empty.
+     * Must only be called by the consumer.
+     */
+    T* front()
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return nullptr;
+        return &slots_[head];
+    }
+
+    /**
+     * \brief Releases the element obtained by front() back to the producer
+     */
+    void pop()
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        head_.store(increment(head), std::memory_order_release);
+    }
+
+    size_t capacity() const { return slots_.size() - 1; }
+private:
+    size_t increment(size_t index) const
+    {
+        return index + 1 == slots_.size() ? 0 : index + 1;
+    }
+
+private:
+    std::vector<T> slots_;
+    alignas(64) std::atomic<size_t> head_;
+    alignas(64) std::atomic<size_t> tail_;
+};
+}
@@ -0,0 +1,58 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file startup_timeline.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cstdio>
+#include <dbot_ros/util/startup_timeline.h>
+
+namespace dbot
+{
+StartupTimeline::StartupTimeline()
+    : start_(ros::WallTime::now()), reported_(false)
+{
+}
+
+void StartupTimeline::done(const std::string& step)
+{
+    double elapsed = (ros::WallTime::now() - start_).toSec();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    steps_.push_back(std::make_pair(step, elapsed));
+}
+
+void StartupTimeline::first_pose()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reported_) return;
+    reported_ = true;
+
+    std::string steps;
+    for (auto& step : steps_)
+    {
+        char entry[128];
+        std::snprintf(entry,
+                      sizeof(entry),
+                      ", %s at %.3f s",
+                      step.first.c_str(),
+                      step.second);
+        steps += entry;
+    }
+
+    ROS_INFO("Time to first pose %.3f s%s",
+             (ros::WallTime::now() - start_).toSec(),
+             steps.c_str());
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file startup_timeline.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <mutex>
+#include <ros/ros.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Records when the concurrent startup steps of a tracker node
+ * complete, relative to the construction of the timeline, and logs them
+ * together with the time to the first published pose.
+ */
+class StartupTimeline
+{
+public:
+    StartupTimeline();
+
+    /**
+     * \brief Records the completion of \c step. May be called from any
+     * thread.
+     */
+    void done(const std::string& step);
+
+    /**
+     * \brief Logs the time to the first pose and the recorded steps on the
+     * first call. Subsequent calls return immediately.
+     */
+    void first_pose();
+
+private:
+    ros::WallTime start_;
+    std::mutex mutex_;
+    std::vector<std::pair<std::string, double>> steps_;
+    bool reported_;
+};
+}
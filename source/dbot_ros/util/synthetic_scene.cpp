@@ -0,0 +1,272 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file synthetic_scene.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cmath>
+#include <cstring>
+#include <dbot/simple_wavefront_object_loader.h>
+#include <dbot_ros/util/synthetic_scene.h>
+#include <limits>
+#include <ros/ros.h>
+
+namespace dbot
+{
+static Eigen::Vector3d to_vector(const YAML::Node& node)
+{
+    auto values = node.as<std::vector<double>>();
+    if (values.size() != 3)
+    {
+        throw YAML::Exception(node.Mark(), "expected 3 values");
+    }
+
+    return Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+SyntheticScene::SyntheticScene(const ObjectResourceIdentifier& ori)
+    : ori_(ori), background_(false), noise_sigma_(0.0),
+      noise_quadratic_(false), dropout_(0.0)
+{
+}
+
+bool SyntheticScene::load(const YAML::Node& scenario, unsigned int seed)
+{
+    random_.seed(seed);
+
+    try
+    {
+        /* camera */
+        const YAML::Node camera = scenario["camera"];
+        camera_info_.header.frame_id =
+            camera["frame_id"].as<std::string>("XTION_depth_optical_frame");
+        camera_info_.width            = camera["width"].as<int>(640);
+        camera_info_.height           = camera["height"].as<int>(480);
+        camera_info_.distortion_model = "plumb_bob";
+        camera_info_.D.assign(5, 0.0);
+
+        double fx = camera["fx"].as<double>(525.0);
+        double fy = camera["fy"].as<double>(525.0);
+        double cx = camera["cx"].as<double>((camera_info_.width - 1) / 2.0);
+        double cy = camera["cy"].as<double>((camera_info_.height - 1) / 2.0);
+
+        Eigen::Matrix3d camera_matrix;
+        camera_matrix << fx, 0, cx, 0, fy, cy, 0, 0, 1;
+        for (int i = 0; i < 9; ++i)
+        {
+            camera_info_.K[i] = camera_matrix(i / 3, i % 3);
+            camera_info_.R[i] = i % 4 == 0 ? 1.0 : 0.0;
+        }
+        for (int i = 0; i < 12; ++i)
+        {
+            camera_info_.P[i] = i % 4 == 3 ? 0.0 : camera_info_.K[i - i / 4];
+        }
+
+        rasterizer_ = std::make_shared<DepthRasterizer>(
+            camera_matrix, camera_info_.width, camera_info_.height);
+
+        /* noise */
+        const YAML::Node noise = scenario["noise"];
+        noise_sigma_     = noise["sigma"].as<double>(0.0);
+        noise_quadratic_ = noise["quadratic"].as<bool>(true);
+        dropout_         = noise["dropout"].as<double>(0.0);
+
+        /* background */
+        const YAML::Node background = scenario["background"];
+        background_ = background.IsDefined();
+        if (background_)
+        {
+            background_point_  = to_vector(background["point"]);
+            background_normal_ = to_vector(background["normal"]).normalized();
+        }
+
+        /* objects */
+        std::vector<DepthRasterizer::Vertices> vertices;
+        std::vector<DepthRasterizer::Triangles> triangles;
+        SimpleWavefrontObjectModelLoader(ori_).load(vertices, triangles);
+
+        const YAML::Node objects = scenario["objects"];
+        if (objects.size() != vertices.size())
+        {
+            ROS_ERROR("The scenario defines %lu trajectories for %lu objects",
+                      objects.size(),
+                      vertices.size());
+            return false;
+        }
+
+        objects_.resize(vertices.size());
+        for (size_t i = 0; i < objects_.size(); ++i)
+        {
+            objects_[i].vertices  = vertices[i];
+            objects_[i].triangles = triangles[i];
+            if (!load_keyframes(objects[i]["keyframes"],
+                                objects_[i].keyframes))
+            {
+                return false;
+            }
+        }
+
+        /* occluders */
+        const YAML::Node occluders = scenario["occluders"];
+        occluders_.resize(occluders.size());
+        for (size_t i = 0; i < occluders_.size(); ++i)
+        {
+            DepthRasterizer::box(to_vector(occluders[i]["size"]),
+                                 occluders_[i].vertices,
+                                 occluders_[i].triangles);
+            if (!load_keyframes(occluders[i]["keyframes"],
+                                occluders_[i].keyframes))
+            {
+                return false;
+            }
+        }
+    }
+    catch (YAML::Exception& e)
+    {
+        ROS_ERROR("Invalid scenario: %s", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+void SyntheticScene::render(double time, sensor_msgs::Image& image)
+{
+    rasterizer_->clear();
+
+    if (background_) rasterizer_->plane(background_point_, background_normal_);
+
+    for (auto& body : objects_)
+    {
+        rasterizer_->mesh(
+            body.vertices, body.triangles, pose(body.keyframes, time));
+    }
+
+    for (auto& body : occluders_)
+    {
+        rasterizer_->mesh(
+            body.vertices, body.triangles, pose(body.keyframes, time));
+    }
+
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<float> depth = rasterizer_->depth();
+    for (auto& z : depth)
+    {
+        bool dropped = dropout_ > 0.0 && uniform(random_) < dropout_;
+        if (dropped || !std::isfinite(z))
+        {
+            z = std::numeric_limits<float>::quiet_NaN();
+            continue;
+        }
+
+        if (noise_sigma_ > 0.0)
+        {
+            double sigma = noise_quadratic_ ? noise_sigma_ * z * z
+                                            : noise_sigma_;
+            z += sigma * gaussian(random_);
+        }
+    }
+
+    image.header.frame_id = camera_info_.header.frame_id;
+    image.width           = camera_info_.width;
+    image.height          = camera_info_.height;
+    image.encoding        = "32FC1";
+    image.is_bigendian    = 0;
+    image.step            = image.width * sizeof(float);
+    image.data.resize(depth.size() * sizeof(float));
+    std::memcpy(image.data.data(), depth.data(), image.data.size());
+}
+
+Eigen::Affine3d SyntheticScene::object_pose(int object, double time) const
+{
+    return pose(objects_[object].keyframes, time);
+}
+
+sensor_msgs::CameraInfo SyntheticScene::camera_info() const
+{
+    return camera_info_;
+}
+
+int SyntheticScene::object_count() const
+{
+    return objects_.size();
+}
+
+bool SyntheticScene::load_keyframes(const YAML::Node& node,
+                                    std::vector<Keyframe>& keyframes)
+{
+    keyframes.clear();
+
+    for (size_t i = 0; i < node.size(); ++i)
+    {
+        Keyframe keyframe;
+        keyframe.time     = node[i]["time"].as<double>(0.0);
+        keyframe.position = to_vector(node[i]["position"]);
+
+        Eigen::Vector3d rotation = to_vector(node[i]["rotation"]);
+        keyframe.orientation =
+            rotation.norm() > 0.0
+                ? Eigen::Quaterniond(Eigen::AngleAxisd(rotation.norm(),
+                                                       rotation.normalized()))
+                : Eigen::Quaterniond::Identity();
+
+        if (!keyframes.empty() && keyframe.time <= keyframes.back().time)
+        {
+            ROS_ERROR("Keyframe times must be increasing");
+            return false;
+        }
+        keyframes.push_back(keyframe);
+    }
+
+    if (keyframes.empty())
+    {
+        ROS_ERROR("Every body requires at least one keyframe");
+        return false;
+    }
+
+    return true;
+}
+
+Eigen::Affine3d SyntheticScene::pose(const std::vector<Keyframe>& keyframes,
+                                     double time)
+{
+    size_t next = 0;
+    while (next < keyframes.size() && keyframes[next].time <= time) ++next;
+
+    Eigen::Vector3d position;
+    Eigen::Quaterniond orientation;
+    if (next == 0 || next == keyframes.size())
+    {
+        auto& keyframe = keyframes[next == 0 ? 0 : next - 1];
+        position       = keyframe.position;
+        orientation    = keyframe.orientation;
+    }
+    else
+    {
+        auto& a = keyframes[next - 1];
+        auto& b = keyframes[next];
+        double alpha = (time - a.time) / (b.time - a.time);
+        position     = (1.0 - alpha) * a.position + alpha * b.position;
+        orientation  = a.orientation.slerp(alpha, b.orientation);
+    }
+
+    Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+    pose.translate(position);
+    pose.rotate(orientation);
+
+    return pose;
+}
+}
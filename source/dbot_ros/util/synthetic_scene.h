@@ -0,0 +1,135 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file synthetic_scene.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/util/depth_rasterizer.h>
+#include <memory>
+#include <random>
+#include <sensor_msgs/CameraInfo.h>
+#include <sensor_msgs/Image.h>
+#include <string>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+namespace dbot
+{
+/**
+ * \brief Scripted scene of the objects of an ORI, box occluders and an
+ * optional background plane, rendered into noisy depth images.
+ *
+ * The scene is described by a scenario YAML node
+ * \code
+ * camera:
+ *   frame_id: XTION_depth_optical_frame
+ *   width: 640
+ *   height: 480
+ *   fx: 525.0
+ *   fy: 525.0
+ *   cx: 319.5
+ *   cy: 239.5
+ * noise:
+ *   sigma: 0.001      # depth noise std at 1 m [m]
+ *   quadratic: true   # noise std grows with the squared depth
+ *   dropout: 0.01     # probability of a missing pixel
+ * background:         # optional plane in the camera frame
+ *   point: [0, 0, 1.5]
+ *   normal: [0, 0, 1]
+ * objects:            # one trajectory per mesh of the ORI
+ *   - keyframes:
+ *       - {time: 0.0, position: [0, 0, 0.8], rotation: [0, 0, 0]}
+ *       - {time: 5.0, position: [0.1, 0, 0.8], rotation: [0, 0, 1.57]}
+ * occluders:
+ *   - size: [0.05, 0.3, 0.05]
+ *     keyframes:
+ *       - {time: 0.0, position: [-0.2, 0, 0.6], rotation: [0, 0, 0]}
+ * \endcode
+ *
+ * Poses are given in the camera frame with the orientation as rotation
+ * vector (axis times angle). Between keyframes, positions are interpolated
+ * linearly and orientations spherically. Before the first and after the last
+ * keyframe, the pose is held.
+ */
+class SyntheticScene
+{
+public:
+    /**
+     * \brief Creates an empty scene. The object meshes are loaded by load().
+     */
+    explicit SyntheticScene(const ObjectResourceIdentifier& ori);
+
+    /**
+     * \brief Loads the object meshes and the scenario
+     * \return false if the scenario is invalid
+     */
+    bool load(const YAML::Node& scenario, unsigned int seed);
+
+    /**
+     * \brief Renders the scene at \c time into a 32FC1 depth image. Missing
+     *        pixels are NaN.
+     */
+    void render(double time, sensor_msgs::Image& image);
+
+    /**
+     * \brief Pose of object \c object in the camera frame at \c time
+     */
+    Eigen::Affine3d object_pose(int object, double time) const;
+
+    sensor_msgs::CameraInfo camera_info() const;
+    int object_count() const;
+
+private:
+    struct Keyframe
+    {
+        double time;
+        Eigen::Vector3d position;
+        Eigen::Quaterniond orientation;
+    };
+
+    struct Body
+    {
+        DepthRasterizer::Vertices vertices;
+        DepthRasterizer::Triangles triangles;
+        std::vector<Keyframe> keyframes;
+    };
+
+    static bool load_keyframes(const YAML::Node& node,
+                               std::vector<Keyframe>& keyframes);
+    static Eigen::Affine3d pose(const std::vector<Keyframe>& keyframes,
+                                double time);
+
+private:
+    ObjectResourceIdentifier ori_;
+    sensor_msgs::CameraInfo camera_info_;
+    std::shared_ptr<DepthRasterizer> rasterizer_;
+
+    std::vector<Body> objects_;
+    std::vector<Body> occluders_;
+
+    bool background_;
+    Eigen::Vector3d background_point_;
+    Eigen::Vector3d background_normal_;
+
+    double noise_sigma_;
+    bool noise_quadratic_;
+    double dropout_;
+    std::mt19937 random_;
+};
+}
@@ -0,0 +1,304 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracker_config.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot_ros/util/shared_pose_channel.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <ros/package.h>
+
+namespace dbot
+{
+ObjectResourceIdentifier ObjectConfig::ori() const
+{
+    ObjectResourceIdentifier ori;
+    ori.package_path(ros::package::getPath(package));
+    ori.directory(directory);
+    ori.meshes(meshes);
+
+    return ori;
+}
+
+std::vector<MeshDecimation> MeshDecimationConfig::levels(
+    const ObjectResourceIdentifier& ori,
+    double focal_length) const
+{
+    if (!enabled) return std::vector<MeshDecimation>();
+
+    std::vector<MeshDecimation> decimation(ori.count_meshes());
+    for (int i = 0; i < ori.count_meshes(); i++)
+    {
+        decimation[i].tolerance = min_distance / focal_length;
+
+        auto object = objects.find(ori.mesh_without_extension(i));
+        if (object == objects.end()) continue;
+        if (object->second.tolerance >= 0.0)
+        {
+            decimation[i].tolerance = object->second.tolerance;
+        }
+        decimation[i].max_triangles = object->second.max_triangles;
+    }
+
+    return decimation;
+}
+
+void read(ParameterReader& reader, CameraConfig& config)
+{
+    reader.required("camera_info_topic", config.camera_info_topic);
+    reader.required("depth_image_topic", config.depth_image_topic);
+    reader.required("downsampling_factor", config.downsampling_factor, 1);
+    reader.required("resolution/width", config.resolution.width, 1);
+    reader.required("resolution/height", config.resolution.height, 1);
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectConfig& config)
+{
+    reader.required(prefix + "package", config.package);
+    reader.required(prefix + "directory", config.directory);
+    reader.required(prefix + "meshes", config.meshes);
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          MeshDecimationConfig& config)
+{
+    reader.optional(prefix + "enabled", config.enabled);
+    reader.optional(prefix + "min_distance", config.min_distance, 0.0);
+
+    // the overrides are read for all configured meshes, such that the
+    // service node knows them before the tracked meshes are requested
+    for (auto& name : reader.keys(prefix + "objects"))
+    {
+        auto object_prefix   = prefix + "objects/" + name + "/";
+        auto& decimation     = config.objects[name];
+        decimation.tolerance = -1.0;
+        reader.optional(object_prefix + "tolerance", decimation.tolerance, 0.0);
+        reader.optional(
+            object_prefix + "max_triangles", decimation.max_triangles, 0);
+    }
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectModelCacheConfig& config)
+{
+    reader.optional(prefix + "enabled", config.enabled);
+    reader.optional(prefix + "directory", config.directory);
+}
+
+void read(ParameterReader& reader, RuntimeConfig& config)
+{
+    reader.optional("predicted_state_publisher/enabled", config.predict_states);
+    auto& predicted = config.predicted_state_publisher;
+    reader.optional("predicted_state_publisher/rate", predicted.rate, 1.0);
+    reader.optional("predicted_state_publisher/max_extrapolation",
+                    predicted.max_extrapolation,
+                    0.0);
+
+    reader.optional("belief_checkpoint/enabled", config.checkpoint_belief);
+    auto& checkpoint = config.belief_checkpoint;
+    reader.optional("belief_checkpoint/path", checkpoint.path);
+    reader.optional("belief_checkpoint/rate", checkpoint.rate, 0.1);
+    reader.optional("belief_checkpoint/max_age", checkpoint.max_age, 0.0);
+
+    reader.optional("shared_pose_channel/enabled", config.share_poses);
+    reader.optional("shared_pose_channel/name",
+                    config.shared_pose_channel_name);
+    if (config.shared_pose_channel_name.empty())
+    {
+        config.shared_pose_channel_name =
+            SharedPoseChannelWriter::default_name(ros::this_node::getName());
+    }
+
+    reader.optional("session_recorder/enabled", config.record_session);
+    reader.optional("session_recorder/path", config.session_path);
+    reader.optional(
+        "session_recorder/queue_size", config.session_queue_size, 1);
+
+    reader.optional("flight_recorder/enabled", config.use_flight_recorder);
+    auto& flight = config.flight_recorder;
+    reader.optional("flight_recorder/path", flight.path);
+    reader.optional("flight_recorder/duration", flight.duration, 0.0);
+    reader.optional("flight_recorder/rate", flight.rate, 1.0);
+    reader.optional("flight_recorder/max_latency", flight.max_latency, 0.0);
+    reader.optional("flight_recorder/max_translation_jump",
+                    flight.max_translation_jump,
+                    0.0);
+    reader.optional(
+        "flight_recorder/max_rotation_jump", flight.max_rotation_jump, 0.0);
+    reader.optional(
+        "flight_recorder/trigger_cooldown", flight.trigger_cooldown, 0.0);
+
+    read(reader, "object_model_cache/", config.object_model_cache);
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ParticleFilterConfig& config)
+{
+    auto& transition       = config.object_transition;
+    auto transition_prefix = prefix + "object_transition/";
+    reader.required(
+        transition_prefix + "linear_sigma_x", transition.linear_sigma_x, 0.0);
+    reader.required(
+        transition_prefix + "linear_sigma_y", transition.linear_sigma_y, 0.0);
+    reader.required(
+        transition_prefix + "linear_sigma_z", transition.linear_sigma_z, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_x", transition.angular_sigma_x, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_y", transition.angular_sigma_y, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_z", transition.angular_sigma_z, 0.0);
+    reader.required(transition_prefix + "velocity_factor",
+                    transition.velocity_factor,
+                    0.0,
+                    1.0);
+    transition.part_count = 1;
+
+    auto& observation   = config.observation;
+    observation.use_gpu = false;
+    reader.required(prefix + "use_gpu", observation.use_gpu);
+    reader.required(prefix + (observation.use_gpu ? "gpu" : "cpu") +
+                        "/sample_count",
+                    observation.sample_count,
+                    1);
+
+    auto& occlusion       = observation.occlusion;
+    auto occlusion_prefix = prefix + "observation/occlusion/";
+    reader.required(occlusion_prefix + "p_occluded_visible",
+                    occlusion.p_occluded_visible,
+                    0.0,
+                    1.0);
+    reader.required(occlusion_prefix + "p_occluded_occluded",
+                    occlusion.p_occluded_occluded,
+                    0.0,
+                    1.0);
+    reader.required(occlusion_prefix + "initial_occlusion_prob",
+                    occlusion.initial_occlusion_prob,
+                    0.0,
+                    1.0);
+
+    auto& kinect       = observation.kinect;
+    auto kinect_prefix = prefix + "observation/kinect/";
+    reader.required(
+        kinect_prefix + "tail_weight", kinect.tail_weight, 0.0, 1.0);
+    reader.required(kinect_prefix + "model_sigma", kinect.model_sigma, 0.0);
+    reader.required(kinect_prefix + "sigma_factor", kinect.sigma_factor, 0.0);
+    observation.delta_time = 1. / 30.;
+
+    // gpu only parameters
+    observation.use_custom_shaders = false;
+    if (observation.use_gpu)
+    {
+        reader.required(prefix + "gpu/use_custom_shaders",
+                        observation.use_custom_shaders);
+        reader.required(prefix + "gpu/vertex_shader_file",
+                        observation.vertex_shader_file);
+        reader.required(prefix + "gpu/fragment_shader_file",
+                        observation.fragment_shader_file);
+        reader.required(prefix + "gpu/geometry_shader_file",
+                        observation.geometry_shader_file);
+    }
+
+    auto& tracker            = config.tracker;
+    tracker.evaluation_count = observation.sample_count;
+    reader.required(prefix + "moving_average_update_rate",
+                    tracker.moving_average_update_rate,
+                    0.0,
+                    1.0);
+    reader.required(
+        prefix + "max_kl_divergence", tracker.max_kl_divergence, 0.0);
+    reader.required(prefix + "center_object_frame",
+                    tracker.center_object_frame);
+
+    reader.required(prefix + "object_color/R", config.object_color[0], 0, 255);
+    reader.required(prefix + "object_color/G", config.object_color[1], 0, 255);
+    reader.required(prefix + "object_color/B", config.object_color[2], 0, 255);
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          GaussianFilterConfig& config)
+{
+    auto& tracker = config.tracker;
+    reader.required(prefix + "unscented_transform/alpha", tracker.ut_alpha);
+    reader.required(prefix + "moving_average_update_rate",
+                    tracker.moving_average_update_rate,
+                    0.0,
+                    1.0);
+    reader.required(prefix + "center_object_frame",
+                    tracker.center_object_frame);
+
+    auto& observation = tracker.observation;
+    reader.required(prefix + "observation/tail_weight",
+                    observation.tail_weight,
+                    0.0,
+                    1.0);
+    reader.required(prefix + "observation/bg_depth", observation.bg_depth);
+    reader.required(
+        prefix + "observation/fg_noise_std", observation.fg_noise_std, 0.0);
+    reader.required(
+        prefix + "observation/bg_noise_std", observation.bg_noise_std, 0.0);
+    reader.required(prefix + "observation/uniform_tail_max",
+                    observation.uniform_tail_max);
+    reader.required(prefix + "observation/uniform_tail_min",
+                    observation.uniform_tail_min);
+
+    auto& transition       = tracker.object_transition;
+    auto transition_prefix = prefix + "object_transition/";
+    reader.required(
+        transition_prefix + "linear_sigma_x", transition.linear_sigma_x, 0.0);
+    reader.required(
+        transition_prefix + "linear_sigma_y", transition.linear_sigma_y, 0.0);
+    reader.required(
+        transition_prefix + "linear_sigma_z", transition.linear_sigma_z, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_x", transition.angular_sigma_x, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_y", transition.angular_sigma_y, 0.0);
+    reader.required(
+        transition_prefix + "angular_sigma_z", transition.angular_sigma_z, 0.0);
+    reader.required(transition_prefix + "velocity_factor",
+                    transition.velocity_factor,
+                    0.0,
+                    1.0);
+    transition.part_count = 1;
+
+    reader.required(prefix + "object_color/R", config.object_color[0], 0, 255);
+    reader.required(prefix + "object_color/G", config.object_color[1], 0, 255);
+    reader.required(prefix + "object_color/B", config.object_color[2], 0, 255);
+}
+
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectStatePublisherParameters& config)
+{
+    reader.optional(prefix + "per_object", config.per_object);
+    reader.optional(prefix + "batched", config.batched);
+    reader.optional(prefix + "marker_rate", config.marker_rate, 0.0);
+    reader.optional(
+        prefix + "deadband_translation", config.deadband_translation, 0.0);
+    reader.optional(
+        prefix + "deadband_rotation", config.deadband_rotation, 0.0);
+    reader.optional(prefix + "keep_alive_rate", config.keep_alive_rate, 0.0);
+    reader.optional(prefix + "latency_compensation",
+                    config.latency_compensation);
+    reader.optional(prefix + "tf", config.tf);
+    reader.optional(prefix + "tf_prefix", config.tf_prefix);
+}
+}
@@ -0,0 +1,209 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracker_config.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Typed configuration of the tracker nodes. The nodes read their
+ * configuration once at startup, validate it as a whole and pass the typed
+ * copy on instead of querying the parameter server again.
+ */
+
+#pragma once
+
+#include <dbot/builder/gaussian_tracker_builder.h>
+#include <dbot/builder/particle_tracker_builder.h>
+#include <dbot/camera_data.h>
+#include <dbot/object_resource_identifier.h>
+#include <dbot/pose/free_floating_rigid_bodies_state.h>
+#include <dbot/tracker/particle_tracker.h>
+#include <dbot_ros/util/mesh_decimation.h>
+#include <dbot_ros/util/parameter_reader.h>
+#include <dbot_ros/util/runtime_parameters.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+struct CameraConfig
+{
+    std::string camera_info_topic;
+    std::string depth_image_topic;
+    int downsampling_factor;
+    CameraData::Resolution resolution;
+};
+
+struct ObjectConfig
+{
+    std::string package;
+    std::string directory;
+    std::vector<std::string> meshes;
+
+    /**
+     * \brief Resolves the package path of the object meshes
+     */
+    ObjectResourceIdentifier ori() const;
+};
+
+/**
+ * \brief Level of detail of the object meshes, see object.yaml
+ */
+struct MeshDecimationConfig
+{
+    MeshDecimationConfig() : enabled(false), min_distance(0.5) {}
+
+    bool enabled;
+    /// nearest expected object distance [m]
+    double min_distance;
+    /// per mesh overrides by mesh name without extension. A negative
+    /// tolerance keeps the default one
+    std::map<std::string, MeshDecimation> objects;
+
+    /**
+     * \brief Returns the level of detail of each mesh of \c ori, or an empty
+     * vector if disabled. The tolerance defaults to the size of a depth pixel
+     * at min_distance, given the focal length of the downsampled camera.
+     */
+    std::vector<MeshDecimation> levels(const ObjectResourceIdentifier& ori,
+                                       double focal_length) const;
+};
+
+/**
+ * \brief Binary cache of the parsed object meshes, see runtime.yaml
+ */
+struct ObjectModelCacheConfig
+{
+    ObjectModelCacheConfig() : enabled(true) {}
+
+    bool enabled;
+    /// empty for CachedObjectModelLoader::default_cache_directory()
+    std::string directory;
+};
+
+/**
+ * \brief Optional features of the tracker nodes, see runtime.yaml. Disabled
+ * features keep their default parameters.
+ */
+struct RuntimeConfig
+{
+    RuntimeConfig()
+        : predict_states(false),
+          checkpoint_belief(false),
+          share_poses(false),
+          record_session(false),
+          session_path("/tmp"),
+          session_queue_size(30),
+          use_flight_recorder(false)
+    {
+    }
+
+    bool predict_states;
+    PredictedStatePublisherParameters predicted_state_publisher;
+
+    bool checkpoint_belief;
+    BeliefCheckpointParameters belief_checkpoint;
+
+    bool share_poses;
+    /// defaults to SharedPoseChannelWriter::default_name() of the node
+    std::string shared_pose_channel_name;
+
+    bool record_session;
+    std::string session_path;
+    int session_queue_size;
+
+    bool use_flight_recorder;
+    FlightRecorderParameters flight_recorder;
+
+    ObjectModelCacheConfig object_model_cache;
+};
+
+struct ParticleFilterConfig
+{
+    typedef FreeFloatingRigidBodiesState<> State;
+
+    /// the part count is set by the node according to the tracked objects
+    ObjectTransitionBuilder<State>::Parameters object_transition;
+    RbSensorBuilder<State>::Parameters observation;
+    ParticleTrackerBuilder<ParticleTracker>::Parameters tracker;
+    int object_color[3];
+};
+
+struct GaussianFilterConfig
+{
+    /// the ORI, the part count and the sensor count are set by the node
+    /// according to the tracked objects and the camera
+    GaussianTrackerBuilder::Parameters tracker;
+    int object_color[3];
+};
+
+/**
+ * \brief Reads the camera.yaml parameters
+ */
+void read(ParameterReader& reader, CameraConfig& config);
+
+/**
+ * \brief Reads the object.yaml parameters below \c prefix, e.g. "object/"
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectConfig& config);
+
+/**
+ * \brief Reads the object.yaml decimation parameters below \c prefix, e.g.
+ * "object/decimation/"
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          MeshDecimationConfig& config);
+
+/**
+ * \brief Reads the optional runtime.yaml object model cache parameters below
+ * \c prefix, e.g. "object_model_cache/". Missing parameters keep their
+ * defaults.
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectModelCacheConfig& config);
+
+/**
+ * \brief Reads the optional runtime.yaml parameters of the predicted state
+ * publisher, the belief checkpoint, the shared pose channel, the recorders
+ * and the object model cache. Missing parameters keep their defaults.
+ */
+void read(ParameterReader& reader, RuntimeConfig& config);
+
+/**
+ * \brief Reads the particle_tracker.yaml parameters below \c prefix, e.g.
+ * "particle_filter/". The gpu parameters are only required if use_gpu is set
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ParticleFilterConfig& config);
+
+/**
+ * \brief Reads the gaussian_tracker.yaml parameters below \c prefix, e.g.
+ * "gaussian_filter/"
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          GaussianFilterConfig& config);
+
+/**
+ * \brief Reads the optional runtime.yaml parameters below \c prefix, e.g.
+ * "object_state_publisher/". Missing parameters keep their defaults.
+ */
+void read(ParameterReader& reader,
+          const std::string& prefix,
+          ObjectStatePublisherParameters& config);
+}
@@ -0,0 +1,149 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracker_factory.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot/builder/gaussian_tracker_builder.h>
+#include <dbot/builder/particle_tracker_builder.h>
+#include <dbot/pose/free_floating_rigid_bodies_state.h>
+#include <dbot/simple_wavefront_object_loader.h>
+#include <dbot_ros/util/cached_object_model_loader.h>
+#include <dbot_ros/util/tracker_factory.h>
+#include <ros/ros.h>
+
+namespace dbot
+{
+bool read(const YamlConfig& yaml,
+          const std::string& tracker_type,
+          OfflineTrackerConfig& config)
+{
+    ParameterReader reader(yaml);
+    read(reader, config.camera);
+    read(reader, "object/", config.object);
+    read(reader, "object/decimation/", config.decimation);
+    read(reader, "object_model_cache/", config.object_model_cache);
+    if (tracker_type == "gaussian")
+    {
+        read(reader, "gaussian_filter/", config.gaussian_filter);
+    }
+    else
+    {
+        read(reader, "particle_filter/", config.particle_filter);
+    }
+
+    return reader.report();
+}
+
+std::shared_ptr<ObjectModel> create_object_model(
+    const ObjectResourceIdentifier& ori,
+    const ObjectModelCacheConfig& cache,
+    const std::vector<MeshDecimation>& decimation,
+    bool center_object_frame)
+{
+    if (!cache.enabled && !decimation.empty())
+    {
+        ROS_WARN("Mesh decimation requires the object model cache");
+    }
+
+    auto object_model_loader =
+        cache.enabled
+            ? std::shared_ptr<ObjectModelLoader>(new CachedObjectModelLoader(
+                  ori, cache.directory, decimation))
+            : std::shared_ptr<ObjectModelLoader>(
+                  new SimpleWavefrontObjectModelLoader(ori));
+
+    // centers the frames of all object part meshes if requested
+    return std::make_shared<ObjectModel>(object_model_loader,
+                                         center_object_frame);
+}
+
+std::shared_ptr<ParticleTracker> create_particle_tracker(
+    const ParticleFilterConfig& config,
+    const std::shared_ptr<ObjectModel>& object_model,
+    const std::shared_ptr<CameraData>& camera_data,
+    int object_count)
+{
+    typedef FreeFloatingRigidBodiesState<> State;
+    typedef ParticleTracker Tracker;
+    typedef ParticleTrackerBuilder<Tracker> TrackerBuilder;
+    typedef TrackerBuilder::TransitionBuilder TransitionBuilder;
+    typedef TrackerBuilder::SensorBuilder SensorBuilder;
+
+    /* ------------------------------ */
+    /* - State transition function  - */
+    /* ------------------------------ */
+    // We will use a linear observation model built by the object transition
+    // model builder. The linear model will generate a random walk.
+    auto params_state       = config.object_transition;
+    params_state.part_count = object_count;
+
+    auto state_trans_builder = std::shared_ptr<TransitionBuilder>(
+        new ObjectTransitionBuilder<State>(params_state));
+
+    /* ------------------------------ */
+    /* - Observation model          - */
+    /* ------------------------------ */
+    auto sensor_builder =
+        std::shared_ptr<SensorBuilder>(new RbSensorBuilder<State>(
+            object_model, camera_data, config.observation));
+
+    /* ------------------------------ */
+    /* - Create Filter & Tracker    - */
+    /* ------------------------------ */
+    auto tracker_builder = TrackerBuilder(
+        state_trans_builder, sensor_builder, object_model, config.tracker);
+
+    return tracker_builder.build();
+}
+
+std::shared_ptr<GaussianTracker> create_gaussian_tracker(
+    const GaussianFilterConfig& config,
+    const ObjectResourceIdentifier& ori,
+    const std::shared_ptr<CameraData>& camera_data)
+{
+    auto params                         = config.tracker;
+    params.ori                          = ori;
+    params.object_transition.part_count = ori.count_meshes();
+    params.observation.sensors          = camera_data->pixels();
+
+    return GaussianTrackerBuilder(params, camera_data).build();
+}
+
+std::shared_ptr<ParticleTracker> create_particle_tracker(
+    const OfflineTrackerConfig& config,
+    const std::shared_ptr<CameraData>& camera_data)
+{
+    auto ori = config.object.ori();
+
+    // the decimation tolerance defaults to a depth pixel at the nearest
+    // expected object distance
+    auto object_model = create_object_model(
+        ori,
+        config.object_model_cache,
+        config.decimation.levels(ori, camera_data->camera_matrix()(0, 0)),
+        config.particle_filter.tracker.center_object_frame);
+
+    return create_particle_tracker(
+        config.particle_filter, object_model, camera_data, ori.count_meshes());
+}
+
+std::shared_ptr<GaussianTracker> create_gaussian_tracker(
+    const OfflineTrackerConfig& config,
+    const std::shared_ptr<CameraData>& camera_data)
+{
+    return create_gaussian_tracker(
+        config.gaussian_filter, config.object.ori(), camera_data);
+}
+}
@@ -0,0 +1,103 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracker_factory.h
+ * \date October 2026
+ * \author agent (agent@local)
+ *
+ * Builds the trackers from their typed configuration, for the tracker nodes
+ * as well as for the offline tools.
+ */
+
+#pragma once
+
+#include <dbot/camera_data.h>
+#include <dbot/object_model.h>
+#include <dbot/object_resource_identifier.h>
+#include <dbot/tracker/gaussian_tracker.h>
+#include <dbot/tracker/particle_tracker.h>
+#include <dbot_ros/util/mesh_decimation.h>
+#include <dbot_ros/util/tracker_config.h>
+#include <dbot_ros/util/yaml_config.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Configuration of the offline tools, read from the same YAML files
+ * and validated like the configuration of the tracker nodes
+ */
+struct OfflineTrackerConfig
+{
+    CameraConfig camera;
+    ObjectConfig object;
+    MeshDecimationConfig decimation;
+    ObjectModelCacheConfig object_model_cache;
+    /// only read for particle trackers
+    ParticleFilterConfig particle_filter;
+    /// only read for Gaussian trackers
+    GaussianFilterConfig gaussian_filter;
+};
+
+/**
+ * \brief Reads the configuration of a \c tracker_type ("particle" or
+ * "gaussian") tracker from \c yaml and logs all invalid parameters
+ * \return true if the configuration is valid
+ */
+bool read(const YamlConfig& yaml,
+          const std::string& tracker_type,
+          OfflineTrackerConfig& config);
+
+/**
+ * \brief Loads the object model of \c ori, parsed once and loaded from the
+ * binary cache afterwards if enabled, at the level of detail \c decimation
+ */
+std::shared_ptr<ObjectModel> create_object_model(
+    const ObjectResourceIdentifier& ori,
+    const ObjectModelCacheConfig& cache,
+    const std::vector<MeshDecimation>& decimation,
+    bool center_object_frame);
+
+/**
+ * \brief Builds a particle tracker of \c object_count objects
+ */
+std::shared_ptr<ParticleTracker> create_particle_tracker(
+    const ParticleFilterConfig& config,
+    const std::shared_ptr<ObjectModel>& object_model,
+    const std::shared_ptr<CameraData>& camera_data,
+    int object_count);
+
+/**
+ * \brief Builds a Gaussian tracker. This loads the object model of \c ori
+ */
+std::shared_ptr<GaussianTracker> create_gaussian_tracker(
+    const GaussianFilterConfig& config,
+    const ObjectResourceIdentifier& ori,
+    const std::shared_ptr<CameraData>& camera_data);
+
+/**
+ * \brief Builds a particle tracker of an offline tool including its object
+ * model
+ */
+std::shared_ptr<ParticleTracker> create_particle_tracker(
+    const OfflineTrackerConfig& config,
+    const std::shared_ptr<CameraData>& camera_data);
+
+/**
+ * \brief Builds a Gaussian tracker of an offline tool
+ */
+std::shared_ptr<GaussianTracker> create_gaussian_tracker(
+    const OfflineTrackerConfig& config,
+    const std::shared_ptr<CameraData>& camera_data);
+}
@@ -0,0 +1,139 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracker_reloader.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <std_srvs/Trigger.h>
+#include <thread>
+
+namespace dbot
+{
+/**
+ * \brief Rebuilds a tracker from the current parameters on request while the
+ * running tracker keeps tracking. The tracking thread picks up the rebuilt
+ * tracker between two frames via rebuilt() and initializes it at the current
+ * estimate, see ObjectTrackerRos::reinitialize().
+ */
+template <typename Tracker>
+class TrackerReloader
+{
+public:
+    /**
+     * \brief Builds a tracker from the current parameters. Returns null if
+     * the parameters are invalid.
+     */
+    typedef std::function<std::shared_ptr<Tracker>()> Build;
+
+public:
+    /**
+     * \param build       Tracker build function
+     * \param background  Whether the tracker is built on a background thread.
+     *                    Trackers owning a thread bound context, e.g. an
+     *                    OpenGL context, must be built on the tracking thread
+     *                    within rebuilt()
+     */
+    explicit TrackerReloader(const Build& build, bool background = true)
+        : build_(build), background_(background), pending_(false), done_(false)
+    {
+    }
+
+    ~TrackerReloader()
+    {
+        if (thread_.joinable()) thread_.join();
+    }
+
+    /**
+     * \brief Requests a rebuild
+     * \return false if a rebuild is already in progress
+     */
+    bool reload()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_) return false;
+        pending_ = true;
+
+        if (!background_) return true;
+
+        // the previous build is done once nothing is pending
+        if (thread_.joinable()) thread_.join();
+        thread_ = std::thread([this]() {
+            auto tracker = build_();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            tracker_ = tracker;
+            done_    = true;
+        });
+
+        return true;
+    }
+
+    /**
+     * \brief Returns the rebuilt tracker once and null otherwise, also if the
+     * rebuild failed. Must be called by the tracking thread between two
+     * frames.
+     */
+    std::shared_ptr<Tracker> rebuilt()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!pending_) return std::shared_ptr<Tracker>();
+
+        if (!background_)
+        {
+            lock.unlock();
+            auto tracker = build_();
+            lock.lock();
+            pending_ = false;
+            return tracker;
+        }
+
+        if (!done_) return std::shared_ptr<Tracker>();
+        pending_ = false;
+        done_    = false;
+
+        std::shared_ptr<Tracker> tracker;
+        tracker.swap(tracker_);
+        return tracker;
+    }
+
+    /**
+     * \brief Service callback requesting a rebuild. The response states
+     * that the belief is reset to the current estimate.
+     */
+    bool reload_srv(std_srvs::Trigger::Request& req,
+                    std_srvs::Trigger::Response& res)
+    {
+        res.success = reload();
+        res.message = res.success
+                          ? "Rebuilding the tracker, it is initialized at "
+                            "the current estimate"
+                          : "Tracker reload already in progress";
+        return true;
+    }
+
+private:
+    Build build_;
+    bool background_;
+    bool pending_;
+    bool done_;
+    std::shared_ptr<Tracker> tracker_;
+    std::mutex mutex_;
+    std::thread thread_;
+};
+}
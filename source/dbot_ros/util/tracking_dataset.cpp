@@ -17,10 +17,14 @@
  * \author Manuel Wuthrich (manuel.wuthrich@gmail.com)
  */
 
+#include <algorithm>
 #include <boost/foreach.hpp>
+#include <cstdlib>
 #include <dbot/helper_functions.h>
 #include <dbot_ros/util/ros_interface.h>
 #include <dbot_ros/util/tracking_dataset.h>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <map>
 #include <message_filters/subscriber.h>
 #include <message_filters/time_synchronizer.h>
 #include <ros/ros.h>
@@ -29,6 +33,43 @@
 #include <tf/message_filter.h>
 #include <tf/tf.h>
 
+namespace
+{
+Eigen::Quaterniond to_quaternion(const Eigen::Vector3d& rotation_vector)
+{
+    double angle = rotation_vector.norm();
+    if (angle == 0.0) return Eigen::Quaterniond::Identity();
+
+    return Eigen::Quaterniond(
+        Eigen::AngleAxisd(angle, rotation_vector / angle));
+}
+
+/**
+ * \brief Interpolates between the states \c s_0 and \c s_1 consisting of
+ * blocks of \c dimension values per object. Each block starts with a
+ * position and an orientation rotation vector. The orientations are
+ * interpolated spherically, all other values linearly.
+ */
+Eigen::VectorXd interpolate(const Eigen::VectorXd& s_0,
+                            const Eigen::VectorXd& s_1,
+                            double w,
+                            int dimension)
+{
+    Eigen::VectorXd state = (1.0 - w) * s_0 + w * s_1;
+    if (dimension < 6 || state.rows() % dimension != 0) return state;
+
+    for (int i = 0; i < state.rows(); i += dimension)
+    {
+        Eigen::Quaterniond q_0 = to_quaternion(s_0.segment<3>(i + 3));
+        Eigen::Quaterniond q_1 = to_quaternion(s_1.segment<3>(i + 3));
+        Eigen::AngleAxisd orientation(q_0.slerp(w, q_1));
+        state.segment<3>(i + 3) = orientation.angle() * orientation.axis();
+    }
+
+    return state;
+}
+}
+
 DataFrame::DataFrame(const sensor_msgs::Image::ConstPtr& image,
                      const sensor_msgs::CameraInfo::ConstPtr& info,
                      const Eigen::VectorXd& ground_truth,
@@ -89,21 +130,48 @@ DataFrame::DataFrame(
 {
 }
 
-TrackingDataset::TrackingDataset(const std::string& path)
+TrackingDataset::TrackingDataset(const std::string& path,
+                                 bool interpolate_ground_truth,
+                                 int object_state_dimension,
+                                 bool load_images)
+    : TrackingDataset(path,
+                      interpolate_ground_truth,
+                      object_state_dimension,
+                      load_images,
+                      true)
+{
+}
+
+TrackingDataset::TrackingDataset(const std::string& path,
+                                 bool interpolate_ground_truth,
+                                 int object_state_dimension,
+                                 bool load_images,
+                                 bool load)
     : path_(path),
       image_topic_("XTION/depth/image"),
       info_topic_("XTION/depth/camera_info"),
       observations_filename_("measurements.bag"),
       ground_truth_filename_("ground_truth.txt"),
-      admissible_delta_time_(0.02)
+      ground_truth_binary_filename_("ground_truth.bin"),
+      admissible_delta_time_(0.02),
+      interpolate_ground_truth_(interpolate_ground_truth),
+      object_state_dimension_(object_state_dimension),
+      load_images_(load_images)
 {
-    Load();
+    if (load) Load();
 }
 
 TrackingDataset::~TrackingDataset()
 {
 }
 
+std::shared_ptr<TrackingDataset> TrackingDataset::CreateEmpty(
+    const std::string& path)
+{
+    return std::shared_ptr<TrackingDataset>(
+        new TrackingDataset(path, false, 6, true, false));
+}
+
 // void TrackingDataset::AddFrame(const sensor_msgs::Image::ConstPtr& image,
 //                               const sensor_msgs::CameraInfo::ConstPtr& info,
 //                               const Eigen::VectorXd& ground_truth,
@@ -129,11 +197,75 @@ void TrackingDataset::AddFrame(const sensor_msgs::Image::ConstPtr& image,
     data_.push_back(data);
 }
 
+void TrackingDataset::AddFrame(const sensor_msgs::Image::ConstPtr& image,
+                               const sensor_msgs::CameraInfo::ConstPtr& info,
+                               const Eigen::VectorXd& ground_truth)
+{
+    DataFrame data(image, info, ground_truth);
+    data_.push_back(data);
+}
+
 sensor_msgs::Image::ConstPtr TrackingDataset::GetImage(const size_t& index)
 {
     return data_[index].image_;
 }
 
+std::vector<sensor_msgs::Image::ConstPtr> TrackingDataset::ReadImages(
+    const std::vector<size_t>& indices)
+{
+    std::vector<sensor_msgs::Image::ConstPtr> images(indices.size());
+
+    // images which are not loaded are matched to their frames by the exact
+    // time stamp like the TimeSynchronizer does on loading
+    std::map<ros::Time, size_t> positions;
+    std::vector<double> bag_times;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        const DataFrame& frame = data_[indices[i]];
+        if (frame.image_)
+        {
+            images[i] = frame.image_;
+            continue;
+        }
+
+        positions[frame.info_->header.stamp] = i;
+        bag_times.push_back(indices[i] < info_bag_times_.size()
+                                ? info_bag_times_[indices[i]].toSec()
+                                : frame.info_->header.stamp.toSec());
+    }
+    if (positions.empty()) return images;
+    std::sort(bag_times.begin(), bag_times.end());
+
+    // an image is recorded within the admissible time difference of its
+    // camera info. Only the chunks of this time range are read from the bag
+    // and only the images close to a requested frame are deserialized
+    const double margin = admissible_delta_time_;
+    rosbag::Bag bag;
+    bag.open((path_ / observations_filename_).string(), rosbag::bagmode::Read);
+    rosbag::View view(bag,
+                      rosbag::TopicQuery(ImageTopics()),
+                      ros::Time(std::max(bag_times.front() - margin, 0.)),
+                      ros::Time(bag_times.back() + margin));
+
+    BOOST_FOREACH (rosbag::MessageInstance const m, view)
+    {
+        double t     = m.getTime().toSec();
+        auto nearest = std::lower_bound(
+            bag_times.begin(), bag_times.end(), t - margin);
+        if (nearest == bag_times.end() || *nearest > t + margin) continue;
+
+        sensor_msgs::Image::ConstPtr image =
+            m.instantiate<sensor_msgs::Image>();
+        if (image == NULL) continue;
+
+        auto position = positions.find(image->header.stamp);
+        if (position != positions.end()) images[position->second] = image;
+    }
+    bag.close();
+
+    return images;
+}
+
 sensor_msgs::CameraInfo::ConstPtr TrackingDataset::GetInfo(const size_t& index)
 {
     return data_[index].info_;
@@ -180,118 +312,304 @@ void TrackingDataset::Load()
     rosbag::Bag bag;
     bag.open((path_ / observations_filename_).string(), rosbag::bagmode::Read);
 
-    // Image topics to load
-    std::vector<std::string> topics;
-    topics.push_back(image_topic_);
-    topics.push_back(info_topic_);
-    topics.push_back("/" + image_topic_);
-    topics.push_back("/" + info_topic_);
-    topics.push_back("/tf");
-    rosbag::View view(bag, rosbag::TopicQuery(topics));
-
-    // Set up fake subscribers to capture images
-    BagSubscriber<sensor_msgs::Image> image_subscriber;
-    BagSubscriber<sensor_msgs::CameraInfo> info_subscriber;
-
-    // Use time synchronizer to make sure we get properly synchronized images
-    message_filters::TimeSynchronizer<sensor_msgs::Image,
-                                      sensor_msgs::CameraInfo>
-        sync(image_subscriber, info_subscriber, 25);
-    sync.registerCallback(
-        boost::bind(&TrackingDataset::AddFrame, this, _1, _2));
-
-    // Load all messages into our stereo TrackingDataset
-    BOOST_FOREACH (rosbag::MessageInstance const m, view)
+    if (!load_images_)
     {
-        if (m.getTopic() == image_topic_ ||
-            (m.getTopic() == "/" + image_topic_))
-        {
-            sensor_msgs::Image::ConstPtr image =
-                m.instantiate<sensor_msgs::Image>();
-            if (image != NULL) image_subscriber.newMessage(image);
-        }
-
-        if (m.getTopic() == info_topic_ || (m.getTopic() == "/" + info_topic_))
+        // only the camera infos are read. The images are read on demand by
+        // ReadImages(), which needs the bag times of the frames
+        rosbag::View view(bag, rosbag::TopicQuery(InfoTopics()));
+        BOOST_FOREACH (rosbag::MessageInstance const m, view)
         {
             sensor_msgs::CameraInfo::ConstPtr info =
                 m.instantiate<sensor_msgs::CameraInfo>();
-            if (info != NULL) info_subscriber.newMessage(info);
+            if (info == NULL) continue;
+
+            AddFrame(sensor_msgs::Image::ConstPtr(), info);
+            info_bag_times_.push_back(m.getTime());
+        }
+    }
+    else
+    {
+        // Image topics to load
+        std::vector<std::string> topics      = ImageTopics();
+        std::vector<std::string> info_topics = InfoTopics();
+        topics.insert(topics.end(), info_topics.begin(), info_topics.end());
+        topics.push_back("/tf");
+        rosbag::View view(bag, rosbag::TopicQuery(topics));
+
+        // Set up fake subscribers to capture images
+        BagSubscriber<sensor_msgs::Image> image_subscriber;
+        BagSubscriber<sensor_msgs::CameraInfo> info_subscriber;
+
+        // Use time synchronizer to make sure we get properly synchronized
+        // images
+        message_filters::TimeSynchronizer<sensor_msgs::Image,
+                                          sensor_msgs::CameraInfo>
+            sync(image_subscriber, info_subscriber, 25);
+        sync.registerCallback(
+            boost::bind(&TrackingDataset::AddFrame, this, _1, _2));
+
+        // Load all messages into our stereo TrackingDataset
+        BOOST_FOREACH (rosbag::MessageInstance const m, view)
+        {
+            if (m.getTopic() == image_topic_ ||
+                (m.getTopic() == "/" + image_topic_))
+            {
+                sensor_msgs::Image::ConstPtr image =
+                    m.instantiate<sensor_msgs::Image>();
+                if (image != NULL) image_subscriber.newMessage(image);
+            }
+
+            if (m.getTopic() == info_topic_ ||
+                (m.getTopic() == "/" + info_topic_))
+            {
+                sensor_msgs::CameraInfo::ConstPtr info =
+                    m.instantiate<sensor_msgs::CameraInfo>();
+                if (info != NULL) info_subscriber.newMessage(info);
+            }
         }
     }
     bag.close();
 
-    // load ground_truth.txt
+    // load ground_truth.bin or ground_truth.txt
     // ---------------------------------------------------------------------
-    if (!LoadTextFile((path_ / ground_truth_filename_).c_str(),
-                      DataType::GROUND_TRUTH))
-        std::cout << "could not open file " << path_ / ground_truth_filename_
-                  << std::endl;
+    // the binary file is a cache of the text file and is ignored once the
+    // text file has been edited or regenerated
+    auto text_path   = path_ / ground_truth_filename_;
+    auto binary_path = path_ / ground_truth_binary_filename_;
+    bool use_binary  = boost::filesystem::exists(binary_path);
+    if (use_binary && boost::filesystem::exists(text_path) &&
+        boost::filesystem::last_write_time(binary_path) <
+            boost::filesystem::last_write_time(text_path))
+    {
+        ROS_WARN("Ignoring %s, it is older than %s",
+                 binary_path.c_str(),
+                 text_path.c_str());
+        use_binary = false;
+    }
+
+    // e.g. a cache written in an older format or another byte order
+    if (use_binary &&
+        !LoadBinaryFile(binary_path.c_str(), DataType::GROUND_TRUTH))
+    {
+        ROS_WARN("Cannot read %s, reading %s instead",
+                 binary_path.c_str(),
+                 text_path.c_str());
+        use_binary = false;
+    }
+
+    if (!use_binary &&
+        !LoadTextFile(text_path.c_str(), DataType::GROUND_TRUTH))
+    {
+        ROS_ERROR("Cannot read ground truth file %s", text_path.c_str());
+    }
+}
+
+std::vector<std::string> TrackingDataset::ImageTopics() const
+{
+    return {image_topic_, "/" + image_topic_};
+}
+
+std::vector<std::string> TrackingDataset::InfoTopics() const
+{
+    return {info_topic_, "/" + info_topic_};
 }
 
 bool TrackingDataset::LoadTextFile(const char* filename, DataType type)
 {
     std::ifstream file;
     file.open(filename, std::ios::in);  // open file
-    if (file.is_open())
+    if (!file.is_open()) return false;
+
+    // parse all rows. each row consists of a time stamp followed by the state
+    std::vector<double> time_stamps;
+    std::vector<Eigen::VectorXd> states;
+    std::vector<double> values;
+    std::string row;
+    while (std::getline(file, row))
     {
-        std::string temp;
-        std::getline(file, temp);
-        std::istringstream line(temp);  // get a line from file
-        double time_stamp;
-        line >> time_stamp;  // get the timestamp
-        double scalar;
-        Eigen::VectorXd state;
-        while (line >> scalar)  // get the state
+        values.clear();
+        const char* begin = row.c_str();
+        char* end         = nullptr;
+        while (true)
         {
-            Eigen::VectorXd temp(state.rows() + 1);
-            temp.topRows(state.rows()) = state;
-            temp(temp.rows() - 1)      = scalar;
-            state                      = temp;
+            double value = std::strtod(begin, &end);
+            if (end == begin) break;
+            values.push_back(value);
+            begin = end;
         }
 
-        std::cout << "read state " << state.transpose() << std::endl;
-        std::cout << "read bagfile of size " << data_.size() << std::endl;
-        std::cout << "timestamp of first image is "
-                  << data_[0].image_->header.stamp << std::endl;
-        file.close();
+        if (values.empty()) continue;
 
-        // attach the state to the appropriate data frames
-        std::cout << "writing states " << std::endl;
-        for (size_t i = 0; i < data_.size(); i++)
-            if (std::fabs(data_[i].image_->header.stamp.toSec() - time_stamp) <=
-                admissible_delta_time_)
-                switch (type)
-                {
-                    case DataType::GROUND_TRUTH:
-                        data_[i].ground_truth_ = state;
-                        break;
-                    case DataType::DEVIATION:
-                        data_[i].deviation_ = state;
-                        break;
-                    default:
-                        return false;
-                }
+        time_stamps.push_back(values[0]);
+        states.push_back(
+            Eigen::Map<Eigen::VectorXd>(values.data() + 1, values.size() - 1));
+    }
+    file.close();
+
+    return AttachStates(time_stamps, states, type);
+}
+
+bool TrackingDataset::LoadBinaryFile(const char* filename, DataType type)
+{
+    dbot::TrackingResultReader reader(filename);
+    std::vector<dbot::TrackingResultRecord> records;
+    if (!reader.is_open() || !reader.read_all(records)) return false;
+
+    std::vector<double> time_stamps(records.size());
+    std::vector<Eigen::VectorXd> states(records.size());
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        time_stamps[i] = records[i].stamp;
+        states[i].swap(records[i].values);
+    }
+
+    return AttachStates(time_stamps, states, type);
+}
+
+bool TrackingDataset::AttachStates(const std::vector<double>& time_stamps,
+                                   const std::vector<Eigen::VectorXd>& states,
+                                   DataType type)
+{
+    std::cout << "read " << states.size() << " states" << std::endl;
+    std::cout << "read bagfile of size " << data_.size() << std::endl;
+
+    if (data_.empty() || states.empty()) return true;
+
+    // the synchronized image and camera info of a frame share their stamp,
+    // hence the info stamp is used which is also known without the image
+    std::cout << "timestamp of first image is "
+              << data_[0].info_->header.stamp << std::endl;
+
+    // sort frames and rows by their time stamps to align them by binary search
+    std::vector<std::pair<double, size_t>> frame_stamps(data_.size());
+    for (size_t i = 0; i < data_.size(); i++)
+    {
+        frame_stamps[i] =
+            std::make_pair(data_[i].info_->header.stamp.toSec(), i);
+    }
+    std::sort(frame_stamps.begin(), frame_stamps.end());
+
+    std::vector<std::pair<double, size_t>> row_stamps(time_stamps.size());
+    for (size_t i = 0; i < time_stamps.size(); i++)
+    {
+        row_stamps[i] = std::make_pair(time_stamps[i], i);
+    }
+    std::sort(row_stamps.begin(), row_stamps.end());
+
+    // attach the states to the appropriate data frames
+    std::cout << "writing states " << std::endl;
+    size_t written = 0;
+    if (interpolate_ground_truth_)
+    {
+        // every frame within the time span of the rows receives a state. The
+        // state is taken from a row within the admissible time difference or
+        // linearly interpolated between the enclosing rows otherwise
+        for (auto& frame_stamp : frame_stamps)
+        {
+            const double t = frame_stamp.first;
+            auto upper =
+                std::lower_bound(row_stamps.begin(),
+                                 row_stamps.end(),
+                                 std::make_pair(t, size_t(0)));
+
+            const bool has_upper = upper != row_stamps.end();
+            const bool has_lower = upper != row_stamps.begin();
+
+            // the nearer of the enclosing rows within the admissible time
+            // difference
+            auto nearest = row_stamps.end();
+            if (has_upper && upper->first - t <= admissible_delta_time_)
+            {
+                nearest = upper;
+            }
+            if (has_lower && t - (upper - 1)->first <= admissible_delta_time_ &&
+                (nearest == row_stamps.end() ||
+                 t - (upper - 1)->first < upper->first - t))
+            {
+                nearest = upper - 1;
+            }
+
+            Eigen::VectorXd state;
+            if (nearest != row_stamps.end())
+            {
+                state = states[nearest->second];
+            }
+            else if (has_lower && has_upper)
+            {
+                auto lower                 = upper - 1;
+                const Eigen::VectorXd& s_0 = states[lower->second];
+                const Eigen::VectorXd& s_1 = states[upper->second];
+                if (s_0.rows() != s_1.rows()) continue;
+
+                double w = (t - lower->first) / (upper->first - lower->first);
+                state    = interpolate(s_0, s_1, w, object_state_dimension_);
+            }
+            else
+            {
+                continue;
+            }
 
-        std::cout << "done writing states " << std::endl;
-        return true;
+            if (!SetState(frame_stamp.second, type, state)) return false;
+            ++written;
+        }
     }
     else
-        return false;
     {
-        std::cout << "could not open file " << path_ / ground_truth_filename_
-                  << std::endl;
-        exit(-1);
+        // every row is attached to all frames within the admissible time
+        // difference
+        for (auto& row_stamp : row_stamps)
+        {
+            const double t = row_stamp.first;
+            auto frame =
+                std::lower_bound(frame_stamps.begin(),
+                                 frame_stamps.end(),
+                                 std::make_pair(t - admissible_delta_time_,
+                                                size_t(0)));
+
+            for (; frame != frame_stamps.end() &&
+                   frame->first <= t + admissible_delta_time_;
+                 ++frame)
+            {
+                if (!SetState(frame->second, type, states[row_stamp.second]))
+                {
+                    return false;
+                }
+                ++written;
+            }
+        }
+    }
+
+    std::cout << "done writing " << written << " states " << std::endl;
+    return true;
+}
+
+bool TrackingDataset::SetState(size_t index,
+                               DataType type,
+                               const Eigen::VectorXd& state)
+{
+    switch (type)
+    {
+        case DataType::GROUND_TRUTH:
+            data_[index].ground_truth_ = state;
+            break;
+        case DataType::DEVIATION:
+            data_[index].deviation_ = state;
+            break;
+        default:
+            return false;
     }
+
+    return true;
 }
 
-void TrackingDataset::Store()
+bool TrackingDataset::Store()
 {
     if (boost::filesystem::exists(path_ / observations_filename_) ||
         boost::filesystem::exists(path_ / ground_truth_filename_))
     {
         std::cout << "TrackingDataset with name " << path_
                   << " already exists, will not overwrite." << std::endl;
-        return;
+        return false;
     }
     else
         boost::filesystem::create_directory(path_);
@@ -317,10 +635,22 @@ void TrackingDataset::Store()
     if (!StoreTextFile((path_ / ground_truth_filename_).c_str(),
                        DataType::GROUND_TRUTH))
     {
-        std::cout << "could not open file " << path_ / ground_truth_filename_
-                  << std::endl;
-        exit(-1);
+        ROS_ERROR("Cannot write ground truth file %s",
+                  (path_ / ground_truth_filename_).c_str());
+        return false;
+    }
+
+    // write ground truth to binary file for fast reloading
+    // ----------------------------------------------------------
+    if (!StoreBinaryFile((path_ / ground_truth_binary_filename_).c_str(),
+                         DataType::GROUND_TRUTH))
+    {
+        // the text file remains, only fast reloading is lost
+        ROS_WARN("Cannot write %s",
+                 (path_ / ground_truth_binary_filename_).c_str());
     }
+
+    return true;
 }
 
 bool TrackingDataset::StoreTextFile(const char* filename, DataType type)
@@ -358,3 +688,43 @@ bool TrackingDataset::StoreTextFile(const char* filename, DataType type)
 
     return true;
 }
+
+bool TrackingDataset::StoreBinaryFile(const char* filename, DataType type)
+{
+    std::vector<size_t> frames;
+    size_t dimension = 0;
+    for (size_t i = 0; i < data_.size(); i++)
+    {
+        const Eigen::VectorXd& state = type == DataType::GROUND_TRUTH
+                                           ? data_[i].ground_truth_
+                                           : data_[i].deviation_;
+        if (state.rows() == 0) continue;
+
+        // records are of fixed width
+        if (!frames.empty() && size_t(state.rows()) != dimension) return false;
+
+        dimension = state.rows();
+        frames.push_back(i);
+    }
+
+    // one pose block of object_state_dimension_ values per object
+    if (dimension % object_state_dimension_ != 0) return false;
+    const uint32_t object_count = dimension / object_state_dimension_;
+
+    dbot::TrackingResultWriter writer(
+        filename,
+        dbot::TrackingResultLayout(
+            object_count, object_state_dimension_, 0, 0));
+    if (!writer.is_open()) return false;
+
+    dbot::TrackingResultRecord record;
+    for (size_t i : frames)
+    {
+        record.stamp  = data_[i].image_->header.stamp.toSec();
+        record.values = type == DataType::GROUND_TRUTH ? data_[i].ground_truth_
+                                                       : data_[i].deviation_;
+        if (!writer.write(record)) return false;
+    }
+
+    return writer.close();
+}
@@ -21,6 +21,7 @@
 #include <Eigen/Dense>
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <memory>
 #include <message_filters/simple_filter.h>
 #include <ros/ros.h>
 #include <sensor_msgs/CameraInfo.h>
@@ -87,9 +88,36 @@ public:
         DEVIATION
     };
 
-    TrackingDataset(const std::string& path);
+    /**
+     * \brief Loads the dataset located in the directory \c path
+     * \param interpolate_ground_truth
+     *          If true, frames without a ground truth row within the
+     *          admissible time difference receive a state interpolated
+     *          between the two enclosing rows
+     * \param object_state_dimension
+     *          Dimension of the ground truth of each object, i.e. 6 for a
+     *          PoseVector and 12 for a PoseVelocityVector. Orientations,
+     *          given as rotation vectors, are interpolated spherically and
+     *          all other values linearly.
+     * \param load_images
+     *          If false, only the camera infos are read from the bag on
+     *          loading and GetImage() returns null. The depth images are
+     *          read on demand by ReadImages() instead, e.g. by a
+     *          PrefetchingFrameSource while replaying.
+     */
+    TrackingDataset(const std::string& path,
+                    bool interpolate_ground_truth = false,
+                    int object_state_dimension    = 6,
+                    bool load_images              = true);
     ~TrackingDataset();
 
+    /**
+     * \brief Creates an empty dataset to be written into the directory
+     * \c path by Store(). Unlike the constructor, nothing is loaded.
+     */
+    static std::shared_ptr<TrackingDataset> CreateEmpty(
+        const std::string& path);
+
     //    void AddFrame(const sensor_msgs::Image::ConstPtr& image,
     //                  const sensor_msgs::CameraInfo::ConstPtr& info,
     //                  const Eigen::VectorXd& ground_truth = Eigen::VectorXd(),
@@ -102,8 +130,23 @@ public:
                   const sensor_msgs::CameraInfo::ConstPtr& info,
                   const tf::tfMessage::ConstPtr& gt_tf);
 
+    void AddFrame(const sensor_msgs::Image::ConstPtr& image,
+                  const sensor_msgs::CameraInfo::ConstPtr& info,
+                  const Eigen::VectorXd& ground_truth);
+
     sensor_msgs::Image::ConstPtr GetImage(const size_t& index);
 
+    /**
+     * \brief Returns the depth images of the frames \c indices. Images which
+     * have not been loaded are read from the bag, covering only the time
+     * range of the requested frames. Each call opens the bag separately,
+     * hence calls may run concurrently.
+     * \return The images in the order of \c indices, null for images which
+     *         are not found in the bag
+     */
+    std::vector<sensor_msgs::Image::ConstPtr> ReadImages(
+        const std::vector<size_t>& indices);
+
     sensor_msgs::CameraInfo::ConstPtr GetInfo(const size_t& index);
 
     //    pcl::PointCloud<pcl::PointXYZ>::ConstPtr GetPointCloud(const size_t&
@@ -117,21 +160,47 @@ public:
 
     void Load();
 
-    void Store();
+    /**
+     * \return false if the dataset already exists or cannot be written
+     */
+    bool Store();
 
 protected:
     bool LoadTextFile(const char* filename, DataType type);
     bool StoreTextFile(const char* filename, DataType type);
+    bool LoadBinaryFile(const char* filename, DataType type);
+    bool StoreBinaryFile(const char* filename, DataType type);
+    bool AttachStates(const std::vector<double>& time_stamps,
+                      const std::vector<Eigen::VectorXd>& states,
+                      DataType type);
+    bool SetState(size_t index, DataType type, const Eigen::VectorXd& state);
+    std::vector<std::string> ImageTopics() const;
+    std::vector<std::string> InfoTopics() const;
 
     std::vector<DataFrame> data_;
+    /**
+     * \brief Bag receive times of the frames' camera infos. Only set if the
+     * images are not loaded.
+     */
+    std::vector<ros::Time> info_bag_times_;
     const boost::filesystem::path path_;
 
     const std::string image_topic_;
     const std::string info_topic_;
     const std::string observations_filename_;
     const std::string ground_truth_filename_;
+    const std::string ground_truth_binary_filename_;
 
 private:
+    TrackingDataset(const std::string& path,
+                    bool interpolate_ground_truth,
+                    int object_state_dimension,
+                    bool load_images,
+                    bool load);
+
     const double admissible_delta_time_;  // admissible time difference in s for
                                           // comparing time stamps
+    const bool interpolate_ground_truth_;
+    const int object_state_dimension_;
+    const bool load_images_;
 };
@@ -0,0 +1,469 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracking_result_file.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <ros/ros.h>
+#include <sys/types.h>
+
+namespace dbot
+{
+namespace
+{
+const char result_file_magic[4]   = {'D', 'B', 'T', 'R'};
+const uint32_t result_file_version = 2;
+
+// reads as 0x04030201 if the file has been written in the other byte order
+const uint32_t result_file_byte_order = 0x01020304;
+
+struct ResultFileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t object_count;
+    uint32_t pose_size;
+    uint32_t velocity_size;
+    uint32_t stats_size;
+    uint32_t block_records;
+};
+
+struct ResultBlockHeader
+{
+    uint32_t record_count;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(ResultFileHeader) == 32,
+              "Tracking result file header must be 32 bytes");
+static_assert(sizeof(ResultBlockHeader) == 8,
+              "Tracking result block header must be 8 bytes");
+
+/**
+ * \brief Number of doubles of a record, or 0 if a record of the header's
+ * layout does not fit into \c max_values doubles. Avoids overflows of
+ * corrupt header values.
+ */
+uint64_t record_values(const ResultFileHeader& header, uint64_t max_values)
+{
+    uint64_t object_values =
+        uint64_t(header.pose_size) + uint64_t(header.velocity_size);
+    if (header.object_count > 0 &&
+        object_values > max_values / header.object_count)
+    {
+        return 0;
+    }
+
+    uint64_t values =
+        1 + header.object_count * object_values + header.stats_size;
+    return values <= max_values ? values : 0;
+}
+}
+
+/* ------------------------------ */
+/* - Writer                     - */
+/* ------------------------------ */
+TrackingResultWriter::TrackingResultWriter(const std::string& filename,
+                                           const TrackingResultLayout& layout,
+                                           uint32_t block_records)
+    : file_(std::fopen(filename.c_str(), "wb")),
+      layout_(layout),
+      block_records_(std::max(block_records, uint32_t(1))),
+      record_(1 + layout.value_count()),
+      block_(record_.size() * block_records_),
+      block_size_(0),
+      failed_(false)
+{
+    if (!file_)
+    {
+        ROS_ERROR("Cannot open tracking result file %s", filename.c_str());
+        return;
+    }
+
+    // blocks are written column by column, hence a large stream buffer
+    std::setvbuf(file_, nullptr, _IOFBF, 1 << 20);
+
+    ResultFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, result_file_magic, sizeof(header.magic));
+    header.version       = result_file_version;
+    header.byte_order    = result_file_byte_order;
+    header.object_count  = layout_.object_count;
+    header.pose_size     = layout_.pose_size;
+    header.velocity_size = layout_.velocity_size;
+    header.stats_size    = layout_.stats_size;
+    header.block_records = block_records_;
+
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1)
+    {
+        ROS_ERROR("Cannot write tracking result file %s", filename.c_str());
+        close();
+    }
+}
+
+TrackingResultWriter::~TrackingResultWriter()
+{
+    close();
+}
+
+bool TrackingResultWriter::is_open() const
+{
+    return file_ != nullptr;
+}
+
+const TrackingResultLayout& TrackingResultWriter::layout() const
+{
+    return layout_;
+}
+
+bool TrackingResultWriter::write(const TrackingResultRecord& record)
+{
+    if (!file_ || size_t(record.values.size()) != layout_.value_count())
+    {
+        return false;
+    }
+
+    record_[0] = record.stamp;
+    std::memcpy(record_.data() + 1,
+                record.values.data(),
+                record.values.size() * sizeof(double));
+
+    return append_record();
+}
+
+bool TrackingResultWriter::write(
+    const std::vector<dbot_ros_msgs::ObjectState>& states,
+    const Eigen::VectorXd& stats)
+{
+    if (!file_ || layout_.pose_size != 7 || layout_.velocity_size != 6 ||
+        states.size() != layout_.object_count ||
+        size_t(stats.size()) != layout_.stats_size)
+    {
+        return false;
+    }
+
+    double* pose     = record_.data() + 1;
+    double* velocity = pose + 7 * states.size();
+
+    record_[0] = states.empty() ? 0. : states[0].pose.header.stamp.toSec();
+    for (auto& state : states)
+    {
+        pose[0] = state.pose.pose.position.x;
+        pose[1] = state.pose.pose.position.y;
+        pose[2] = state.pose.pose.position.z;
+        pose[3] = state.pose.pose.orientation.w;
+        pose[4] = state.pose.pose.orientation.x;
+        pose[5] = state.pose.pose.orientation.y;
+        pose[6] = state.pose.pose.orientation.z;
+        pose += 7;
+
+        velocity[0] = state.velocity.twist.linear.x;
+        velocity[1] = state.velocity.twist.linear.y;
+        velocity[2] = state.velocity.twist.linear.z;
+        velocity[3] = state.velocity.twist.angular.x;
+        velocity[4] = state.velocity.twist.angular.y;
+        velocity[5] = state.velocity.twist.angular.z;
+        velocity += 6;
+    }
+
+    if (stats.size() > 0)
+    {
+        std::memcpy(velocity, stats.data(), stats.size() * sizeof(double));
+    }
+
+    return append_record();
+}
+
+bool TrackingResultWriter::append_record()
+{
+    for (size_t column = 0; column < record_.size(); ++column)
+    {
+        block_[column * block_records_ + block_size_] = record_[column];
+    }
+    ++block_size_;
+
+    return block_size_ < block_records_ || write_block();
+}
+
+bool TrackingResultWriter::write_block()
+{
+    ResultBlockHeader header;
+    header.record_count = block_size_;
+    header.reserved     = 0;
+
+    bool written = std::fwrite(&header, sizeof(header), 1, file_) == 1;
+    for (size_t column = 0; written && column < record_.size(); ++column)
+    {
+        written = std::fwrite(block_.data() + column * block_records_,
+                              sizeof(double),
+                              block_size_,
+                              file_) == block_size_;
+    }
+    block_size_ = 0;
+
+    if (!written) failed_ = true;
+    return written;
+}
+
+bool TrackingResultWriter::close()
+{
+    if (!file_) return false;
+
+    if (block_size_ > 0) write_block();
+
+    bool closed = std::fclose(file_) == 0 && !failed_;
+    file_       = nullptr;
+
+    if (!closed) ROS_ERROR("Cannot write tracking result file");
+    return closed;
+}
+
+/* ------------------------------ */
+/* - Reader                     - */
+/* ------------------------------ */
+TrackingResultReader::TrackingResultReader(const std::string& filename)
+    : file_(std::fopen(filename.c_str(), "rb")), block_records_(0), size_(0)
+{
+    if (!file_)
+    {
+        ROS_ERROR("Cannot open tracking result file %s", filename.c_str());
+        return;
+    }
+
+    ResultFileHeader header;
+    if (std::fread(&header, sizeof(header), 1, file_) != 1 ||
+        std::memcmp(header.magic, result_file_magic, sizeof(header.magic)) !=
+            0 ||
+        header.version != result_file_version || header.block_records == 0)
+    {
+        ROS_ERROR("%s is not a tracking result file", filename.c_str());
+        std::fclose(file_);
+        file_ = nullptr;
+        return;
+    }
+
+    if (header.byte_order != result_file_byte_order)
+    {
+        ROS_ERROR("%s has been written with a different byte order",
+                  filename.c_str());
+        std::fclose(file_);
+        file_ = nullptr;
+        return;
+    }
+
+    fseeko(file_, 0, SEEK_END);
+    const uint64_t file_size = ftello(file_);
+
+    // the header counts are validated against the file size before anything
+    // is allocated, all blocks but the last have to be complete
+    uint64_t offset = sizeof(header);
+    uint64_t values = 0;
+    while (offset + sizeof(ResultBlockHeader) <= file_size)
+    {
+        ResultBlockHeader block;
+        if (fseeko(file_, offset, SEEK_SET) != 0 ||
+            std::fread(&block, sizeof(block), 1, file_) != 1)
+        {
+            break;
+        }
+
+        uint64_t max_values =
+            (file_size - offset - sizeof(block)) / sizeof(double);
+        if (values == 0) values = record_values(header, max_values);
+
+        if (values == 0 || block.record_count == 0 ||
+            block.record_count > header.block_records ||
+            block.record_count > max_values / values)
+        {
+            break;
+        }
+
+        size_ += block.record_count;
+        offset += sizeof(block) + block.record_count * values * sizeof(double);
+        if (block.record_count < header.block_records) break;
+    }
+
+    if (offset != file_size)
+    {
+        ROS_WARN("%s is truncated or corrupt after %zu records",
+                 filename.c_str(),
+                 size_);
+    }
+
+    block_records_ = header.block_records;
+
+    layout_ = TrackingResultLayout(header.object_count,
+                                   header.pose_size,
+                                   header.velocity_size,
+                                   header.stats_size);
+}
+
+TrackingResultReader::~TrackingResultReader()
+{
+    if (file_) std::fclose(file_);
+}
+
+bool TrackingResultReader::is_open() const
+{
+    return file_ != nullptr;
+}
+
+const TrackingResultLayout& TrackingResultReader::layout() const
+{
+    return layout_;
+}
+
+size_t TrackingResultReader::size() const
+{
+    return size_;
+}
+
+size_t TrackingResultReader::seek(size_t index, size_t column)
+{
+    const size_t block      = index / block_records_;
+    const size_t first      = block * block_records_;
+    const size_t block_size = std::min(size_ - first, size_t(block_records_));
+    const size_t row        = index - first;
+
+    off_t offset = sizeof(ResultFileHeader) +
+                   block * (sizeof(ResultBlockHeader) +
+                            block_records_ * layout_.record_bytes()) +
+                   sizeof(ResultBlockHeader) +
+                   (column * block_size + row) * sizeof(double);
+
+    return fseeko(file_, offset, SEEK_SET) == 0 ? block_size - row : 0;
+}
+
+bool TrackingResultReader::read(size_t index, TrackingResultRecord& record)
+{
+    if (!file_ || index >= size_) return false;
+
+    record.values.resize(layout_.value_count());
+    for (size_t column = 0; column <= layout_.value_count(); ++column)
+    {
+        double* value =
+            column == 0 ? &record.stamp : record.values.data() + column - 1;
+        if (seek(index, column) == 0 ||
+            std::fread(value, sizeof(double), 1, file_) != 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TrackingResultReader::read_all(std::vector<TrackingResultRecord>& records)
+{
+    if (!file_) return false;
+
+    const size_t record_size = 1 + layout_.value_count();
+    std::vector<double> block;
+
+    records.resize(size_);
+    for (size_t first = 0; first < size_; first += block_records_)
+    {
+        const size_t block_size = seek(first, 0);
+        block.resize(block_size * record_size);
+        if (block_size == 0 ||
+            std::fread(block.data(), sizeof(double), block.size(), file_) !=
+                block.size())
+        {
+            return false;
+        }
+
+        for (size_t row = 0; row < block_size; ++row)
+        {
+            TrackingResultRecord& record = records[first + row];
+            record.stamp                 = block[row];
+            record.values.resize(record_size - 1);
+            for (size_t column = 1; column < record_size; ++column)
+            {
+                record.values(column - 1) = block[column * block_size + row];
+            }
+        }
+    }
+
+    return true;
+}
+
+bool TrackingResultReader::read_column(size_t column,
+                                       std::vector<double>& values)
+{
+    if (!file_ || column > layout_.value_count()) return false;
+
+    values.resize(size_);
+    for (size_t first = 0; first < size_; first += block_records_)
+    {
+        const size_t block_size = seek(first, column);
+        if (block_size == 0 ||
+            std::fread(values.data() + first,
+                       sizeof(double),
+                       block_size,
+                       file_) != block_size)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::vector<dbot_ros_msgs::ObjectState> TrackingResultReader::to_object_states(
+    const TrackingResultRecord& record) const
+{
+    std::vector<dbot_ros_msgs::ObjectState> states;
+
+    if (layout_.pose_size != 7 || layout_.velocity_size != 6 ||
+        size_t(record.values.size()) != layout_.value_count())
+    {
+        return states;
+    }
+
+    states.resize(layout_.object_count);
+
+    const double* pose     = record.values.data();
+    const double* velocity = pose + 7 * states.size();
+
+    ros::Time stamp;
+    stamp.fromSec(record.stamp);
+    for (auto& state : states)
+    {
+        state.pose.header.stamp        = stamp;
+        state.pose.pose.position.x     = pose[0];
+        state.pose.pose.position.y     = pose[1];
+        state.pose.pose.position.z     = pose[2];
+        state.pose.pose.orientation.w  = pose[3];
+        state.pose.pose.orientation.x  = pose[4];
+        state.pose.pose.orientation.y  = pose[5];
+        state.pose.pose.orientation.z  = pose[6];
+        pose += 7;
+
+        state.velocity.header.stamp    = stamp;
+        state.velocity.twist.linear.x  = velocity[0];
+        state.velocity.twist.linear.y  = velocity[1];
+        state.velocity.twist.linear.z  = velocity[2];
+        state.velocity.twist.angular.x = velocity[3];
+        state.velocity.twist.angular.y = velocity[4];
+        state.velocity.twist.angular.z = velocity[5];
+        velocity += 6;
+    }
+
+    return states;
+}
+}
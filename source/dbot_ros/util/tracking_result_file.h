@@ -0,0 +1,244 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracking_result_file.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <cstdint>
+#include <cstdio>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <string>
+#include <vector>
+
+namespace dbot
+{
+/**
+ * \brief Layout of the fixed-width records of a tracking result file.
+ *
+ * Each record is a sequence of doubles
+ *
+ *     stamp | poses | velocities | stats
+ *
+ * where poses and velocities contain \c object_count blocks of \c pose_size
+ * and \c velocity_size values respectively.
+ *
+ * A tracking result file consists of a 32 byte header followed by blocks of
+ * records. Each block starts with its 8 byte record count and stores its
+ * records column by column, i.e. the stamps of all its records first, then
+ * the first value of all its records and so forth. All blocks but the last
+ * hold the number of records given in the header. The values are stored in
+ * the byte order of the writer, which the header records. Files of the
+ * other byte order are rejected.
+ */
+struct TrackingResultLayout
+{
+    TrackingResultLayout()
+        : object_count(0), pose_size(0), velocity_size(0), stats_size(0)
+    {
+    }
+
+    TrackingResultLayout(uint32_t object_count_,
+                         uint32_t pose_size_,
+                         uint32_t velocity_size_,
+                         uint32_t stats_size_)
+        : object_count(object_count_),
+          pose_size(pose_size_),
+          velocity_size(velocity_size_),
+          stats_size(stats_size_)
+    {
+    }
+
+    /**
+     * \brief Layout of ObjectState messages, i.e. position and quaternion
+     * (x, y, z, qw, qx, qy, qz) and linear and angular velocity per object
+     */
+    static TrackingResultLayout object_states(uint32_t object_count,
+                                              uint32_t stats_size = 0)
+    {
+        return TrackingResultLayout(object_count, 7, 6, stats_size);
+    }
+
+    /**
+     * \brief Number of values following the stamp in each record
+     */
+    size_t value_count() const
+    {
+        return size_t(object_count) * (pose_size + velocity_size) + stats_size;
+    }
+
+    /**
+     * \brief Size of a record in bytes
+     */
+    size_t record_bytes() const { return (1 + value_count()) * sizeof(double); }
+
+    bool operator==(const TrackingResultLayout& other) const
+    {
+        return object_count == other.object_count &&
+               pose_size == other.pose_size &&
+               velocity_size == other.velocity_size &&
+               stats_size == other.stats_size;
+    }
+
+    uint32_t object_count;
+    uint32_t pose_size;
+    uint32_t velocity_size;
+    uint32_t stats_size;
+};
+
+/**
+ * \brief A single frame of a tracking result file
+ */
+struct TrackingResultRecord
+{
+    double stamp;
+
+    /**
+     * \brief All record values following the stamp as specified by the
+     * TrackingResultLayout
+     */
+    Eigen::VectorXd values;
+};
+
+/**
+ * \brief Appends fixed-width records to a tracking result file.
+ *
+ * Records are buffered until a block is complete. The records of an
+ * incomplete block are written by close().
+ */
+class TrackingResultWriter
+{
+public:
+    /**
+     * \brief Creates (and truncates) the file \c filename and writes the
+     * header for the given layout
+     * \param block_records
+     *          Number of records per column-wise stored block
+     */
+    TrackingResultWriter(const std::string& filename,
+                         const TrackingResultLayout& layout,
+                         uint32_t block_records = 256);
+
+    ~TrackingResultWriter();
+
+    bool is_open() const;
+    const TrackingResultLayout& layout() const;
+
+    /**
+     * \brief Appends a record. The record must contain exactly
+     * layout().value_count() values.
+     */
+    bool write(const TrackingResultRecord& record);
+
+    /**
+     * \brief Appends the object states of a frame. Requires a layout created
+     * by TrackingResultLayout::object_states().
+     */
+    bool write(const std::vector<dbot_ros_msgs::ObjectState>& states,
+               const Eigen::VectorXd& stats = Eigen::VectorXd());
+
+    /**
+     * \brief Writes the incomplete block and closes the file
+     * \return false if the file was not open or the buffered records could
+     *         not be written
+     */
+    bool close();
+
+private:
+    /**
+     * \brief Appends the record in record_ to the current block
+     */
+    bool append_record();
+    bool write_block();
+
+private:
+    std::FILE* file_;
+    TrackingResultLayout layout_;
+    uint32_t block_records_;
+
+    /**
+     * \brief Record being written as stamp followed by its values
+     */
+    std::vector<double> record_;
+
+    /**
+     * \brief Columns of the current block, each of block_records_ values
+     */
+    std::vector<double> block_;
+    uint32_t block_size_;
+    bool failed_;
+};
+
+/**
+ * \brief Reads tracking result files written by TrackingResultWriter
+ */
+class TrackingResultReader
+{
+public:
+    /**
+     * \brief Opens the file \c filename and validates its header and block
+     * sizes against the file size. A truncated last block is ignored.
+     */
+    explicit TrackingResultReader(const std::string& filename);
+
+    ~TrackingResultReader();
+
+    bool is_open() const;
+    const TrackingResultLayout& layout() const;
+
+    /**
+     * \brief Number of records in the file
+     */
+    size_t size() const;
+
+    /**
+     * \brief Reads the record at position \c index
+     */
+    bool read(size_t index, TrackingResultRecord& record);
+
+    /**
+     * \brief Reads all records in one pass
+     */
+    bool read_all(std::vector<TrackingResultRecord>& records);
+
+    /**
+     * \brief Reads a single column of all records, i.e. the stamps for
+     * \c column 0 and the value \c column - 1 otherwise
+     */
+    bool read_column(size_t column, std::vector<double>& values);
+
+    /**
+     * \brief Converts a record of an object state layout back to ObjectState
+     * messages containing pose and velocity
+     */
+    std::vector<dbot_ros_msgs::ObjectState> to_object_states(
+        const TrackingResultRecord& record) const;
+
+private:
+    /**
+     * \brief Seeks to the values of \c column within the block holding the
+     * record \c index
+     * \return Number of records of that block from \c index onwards
+     */
+    size_t seek(size_t index, size_t column);
+
+private:
+    std::FILE* file_;
+    TrackingResultLayout layout_;
+    uint32_t block_records_;
+    size_t size_;
+};
+}
@@ -0,0 +1,88 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file yaml_config.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot_ros/util/yaml_config.h>
+#include <iostream>
+#include <sstream>
+
+namespace dbot
+{
+static YAML::Node find_node(const YAML::Node& node,
+                            const std::vector<std::string>& keys,
+                            size_t i)
+{
+    if (i == keys.size()) return node;
+    if (!node.IsMap()) return YAML::Node(YAML::NodeType::Undefined);
+
+    // const lookup does not insert missing keys
+    const YAML::Node child = node[keys[i]];
+    if (!child) return YAML::Node(YAML::NodeType::Undefined);
+
+    return find_node(child, keys, i + 1);
+}
+
+bool YamlConfig::load(const std::string& filename)
+{
+    try
+    {
+        files_.push_back(YAML::LoadFile(filename));
+    }
+    catch (YAML::Exception& e)
+    {
+        std::cerr << "could not load " << filename << ": " << e.what()
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void YamlConfig::set(const std::string& path, const YAML::Node& value)
+{
+    overrides_.push_back(std::make_pair(path, value));
+}
+
+YAML::Node YamlConfig::find(const std::string& path) const
+{
+    for (auto it = overrides_.rbegin(); it != overrides_.rend(); ++it)
+    {
+        if (it->first == path) return it->second;
+    }
+
+    auto keys = split(path);
+    for (auto it = files_.rbegin(); it != files_.rend(); ++it)
+    {
+        const YAML::Node node = find_node(*it, keys, 0);
+        if (node) return node;
+    }
+
+    return YAML::Node(YAML::NodeType::Undefined);
+}
+
+std::vector<std::string> YamlConfig::split(const std::string& path)
+{
+    std::vector<std::string> keys;
+    std::stringstream stream(path);
+    std::string key;
+    while (std::getline(stream, key, '/'))
+    {
+        if (!key.empty()) keys.push_back(key);
+    }
+
+    return keys;
+}
+}
@@ -0,0 +1,61 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file yaml_config.h
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+namespace dbot
+{
+/**
+ * \brief Tracker configuration read directly from YAML files, i.e. without
+ * a ROS parameter server.
+ *
+ * Parameters are addressed by slash separated paths as with
+ * ros::NodeHandle::getParam. Files loaded later override earlier ones and
+ * values set explicitly override all files. The parameters are read and
+ * validated through a ParameterReader on a YamlParameterSource.
+ */
+class YamlConfig
+{
+public:
+    /**
+     * \brief Adds the YAML file \c filename
+     */
+    bool load(const std::string& filename);
+
+    /**
+     * \brief Overrides the parameter at \c path by \c value
+     */
+    void set(const std::string& path, const YAML::Node& value);
+
+    /**
+     * \brief Returns the node at \c path or an invalid node if the parameter
+     * does not exist.
+     */
+    YAML::Node find(const std::string& path) const;
+
+    static std::vector<std::string> split(const std::string& path);
+
+private:
+    std::vector<YAML::Node> files_;
+    std::vector<std::pair<std::string, YAML::Node>> overrides_;
+};
+}
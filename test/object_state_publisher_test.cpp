@@ -0,0 +1,230 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file object_state_publisher_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <dbot/object_resource_identifier.h>
+#include <dbot_ros/object_tracker_publisher.h>
+#include <dbot_ros_msgs/ObjectState.h>
+#include <geometry_msgs/Pose.h>
+#include <gtest/gtest.h>
+#include <new>
+#include <ros/ros.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+// only the allocations of the testing thread are counted, the roscpp
+// background threads allocate at will
+thread_local bool counting            = false;
+thread_local std::size_t allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    if (counting) ++allocations;
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+namespace
+{
+dbot::ObjectResourceIdentifier make_ori()
+{
+    return dbot::ObjectResourceIdentifier(
+        "/tmp", "meshes", {"duck.obj", "box.obj", "duck.obj"});
+}
+
+/**
+ * \brief Exposes the deadband decision of the publisher
+ */
+class DeadbandPublisher : public dbot::ObjectStatePublisher
+{
+public:
+    DeadbandPublisher(const dbot::ObjectResourceIdentifier& ori,
+                      double deadband_translation,
+                      double deadband_rotation)
+        : dbot::ObjectStatePublisher(
+              ori, 0, 255, 0, parameters(deadband_translation,
+                                         deadband_rotation))
+    {
+    }
+
+    using dbot::ObjectStatePublisher::state_due;
+
+private:
+    static Parameters parameters(double deadband_translation,
+                                 double deadband_rotation)
+    {
+        Parameters params;
+        params.deadband_translation = deadband_translation;
+        params.deadband_rotation    = deadband_rotation;
+        // no keep-alive, only the motion decides
+        params.keep_alive_rate = 0.0;
+        return params;
+    }
+};
+
+geometry_msgs::Pose make_pose(double x, double angle)
+{
+    // rotation about z
+    geometry_msgs::Pose pose;
+    pose.position.x    = x;
+    pose.orientation.w = std::cos(angle / 2.0);
+    pose.orientation.z = std::sin(angle / 2.0);
+    return pose;
+}
+
+std::vector<dbot_ros_msgs::ObjectState> make_states(int count)
+{
+    std::vector<dbot_ros_msgs::ObjectState> states(count);
+    for (auto& state : states)
+    {
+        state.pose.header.stamp        = ros::Time::now();
+        state.pose.header.frame_id     = "/XTION_RGB";
+        state.pose.pose.orientation.w  = 1.0;
+        state.velocity.header          = state.pose.header;
+        state.velocity.twist.linear.x  = 0.1;
+        state.velocity.twist.angular.z = 0.1;
+    }
+    return states;
+}
+
+/**
+ * \brief Returns the number of allocations of repeatedly publishing moving
+ *        states after a first warm-up frame
+ */
+std::size_t count_publish_allocations(
+    const dbot::ObjectStatePublisher::Parameters& params)
+{
+    auto ori       = make_ori();
+    auto publisher = dbot::ObjectStatePublisher(ori, 0, 255, 0, params);
+    auto states    = make_states(ori.count_meshes());
+
+    publisher.publish(states);
+
+    counting    = true;
+    allocations = 0;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        for (auto& state : states)
+        {
+            state.pose.pose.position.x += 0.01;
+            state.pose.header.stamp += ros::Duration(1. / 30.);
+            state.velocity.header.stamp = state.pose.header.stamp;
+        }
+        publisher.publish(states);
+    }
+    counting = false;
+
+    return allocations;
+}
+}
+
+TEST(ObjectStatePublisherTests, per_object_publish_does_not_allocate)
+{
+    dbot::ObjectStatePublisher::Parameters params;
+    params.per_object = true;
+    params.batched    = false;
+
+    EXPECT_EQ(0u, count_publish_allocations(params));
+}
+
+TEST(ObjectStatePublisherTests, batched_publish_does_not_allocate)
+{
+    dbot::ObjectStatePublisher::Parameters params;
+    params.per_object = false;
+    params.batched    = true;
+
+    EXPECT_EQ(0u, count_publish_allocations(params));
+}
+
+TEST(ObjectStatePublisherTests, compensated_publish_does_not_allocate)
+{
+    dbot::ObjectStatePublisher::Parameters params;
+    params.per_object           = true;
+    params.batched              = true;
+    params.latency_compensation = true;
+
+    EXPECT_EQ(0u, count_publish_allocations(params));
+}
+
+TEST(ObjectStatePublisherTests, deadband_publish_does_not_allocate)
+{
+    dbot::ObjectStatePublisher::Parameters params;
+    params.per_object           = true;
+    params.batched              = true;
+    params.deadband_translation = 0.05;
+    params.deadband_rotation    = 0.05;
+
+    EXPECT_EQ(0u, count_publish_allocations(params));
+}
+
+TEST(ObjectStatePublisherTests, deadband_rotation_only_motion)
+{
+    auto publisher = DeadbandPublisher(make_ori(), 0.05, 0.1);
+
+    EXPECT_TRUE(publisher.state_due(0, make_pose(0.0, 0.0)));
+    EXPECT_FALSE(publisher.state_due(0, make_pose(0.0, 0.05)));
+    EXPECT_TRUE(publisher.state_due(0, make_pose(0.0, 0.2)));
+    EXPECT_FALSE(publisher.state_due(0, make_pose(0.0, 0.2)));
+}
+
+TEST(ObjectStatePublisherTests, deadband_translation_only_motion)
+{
+    auto publisher = DeadbandPublisher(make_ori(), 0.05, 0.1);
+
+    EXPECT_TRUE(publisher.state_due(0, make_pose(0.0, 0.0)));
+    EXPECT_FALSE(publisher.state_due(0, make_pose(0.02, 0.0)));
+    EXPECT_TRUE(publisher.state_due(0, make_pose(0.1, 0.0)));
+    EXPECT_FALSE(publisher.state_due(0, make_pose(0.1, 0.0)));
+}
+
+TEST(ObjectStatePublisherTests, zero_threshold_publishes_any_change_on_its_axis)
+{
+    // translation threshold zero: any translation is published, rotations
+    // within the rotation threshold are not
+    auto translating = DeadbandPublisher(make_ori(), 0.0, 0.1);
+    EXPECT_TRUE(translating.state_due(0, make_pose(0.0, 0.0)));
+    EXPECT_FALSE(translating.state_due(0, make_pose(0.0, 0.05)));
+    EXPECT_TRUE(translating.state_due(0, make_pose(0.001, 0.05)));
+    EXPECT_FALSE(translating.state_due(0, make_pose(0.001, 0.05)));
+
+    // rotation threshold zero: any rotation is published, translations
+    // within the translation threshold are not
+    auto rotating = DeadbandPublisher(make_ori(), 0.05, 0.0);
+    EXPECT_TRUE(rotating.state_due(0, make_pose(0.0, 0.0)));
+    EXPECT_FALSE(rotating.state_due(0, make_pose(0.02, 0.0)));
+    EXPECT_TRUE(rotating.state_due(0, make_pose(0.02, 0.001)));
+    EXPECT_FALSE(rotating.state_due(0, make_pose(0.02, 0.001)));
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    ros::init(argc, argv, "object_state_publisher_test");
+    ros::NodeHandle nh;
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file shared_pose_channel_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <dbot_ros/util/shared_pose_channel.h>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+std::string channel_name(const std::string& test)
+{
+    return "/dbot_poses_test_" + test + "_" + std::to_string(getpid());
+}
+
+std::vector<dbot::SharedPose> make_poses(double x)
+{
+    std::vector<dbot::SharedPose> poses(1);
+    poses[0].position[0]    = x;
+    poses[0].orientation[0] = 1.0;
+    return poses;
+}
+}
+
+TEST(SharedPoseChannel, reader_sees_the_latest_snapshot)
+{
+    auto name = channel_name("snapshot");
+    dbot::SharedPoseChannelWriter writer(name, 2);
+    ASSERT_TRUE(writer.is_open());
+
+    dbot::SharedPoseChannelReader reader(name);
+    ASSERT_TRUE(reader.is_open());
+
+    int64_t stamp;
+    std::vector<dbot::SharedPose> poses;
+    EXPECT_FALSE(reader.read(stamp, poses));
+
+    writer.write(10, make_poses(0.5));
+    writer.write(20, make_poses(0.75));
+    ASSERT_TRUE(reader.read(stamp, poses));
+    EXPECT_EQ(20, stamp);
+    ASSERT_EQ(1u, poses.size());
+    EXPECT_EQ(0.75, poses[0].position[0]);
+    EXPECT_EQ(4u, reader.sequence());
+}
+
+TEST(SharedPoseChannel, running_writer_keeps_its_segment)
+{
+    auto name = channel_name("running");
+    dbot::SharedPoseChannelWriter writer(name, 1);
+    ASSERT_TRUE(writer.is_open());
+    writer.write(10, make_poses(0.5));
+
+    dbot::SharedPoseChannelWriter second_writer(name, 1);
+    EXPECT_FALSE(second_writer.is_open());
+
+    int64_t stamp;
+    std::vector<dbot::SharedPose> poses;
+    dbot::SharedPoseChannelReader reader(name);
+    ASSERT_TRUE(reader.read(stamp, poses));
+    EXPECT_EQ(0.5, poses[0].position[0]);
+}
+
+TEST(SharedPoseChannel, segment_of_a_crashed_writer_is_replaced)
+{
+    auto name = channel_name("crashed");
+
+    // the child exits without destroying its writer, i.e. leaves the
+    // segment behind like a crashed tracker
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        auto writer = new dbot::SharedPoseChannelWriter(name, 1);
+        writer->write(10, make_poses(0.5));
+        _exit(writer->is_open() ? 0 : 1);
+    }
+    int status;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    ASSERT_EQ(0, WEXITSTATUS(status));
+
+    dbot::SharedPoseChannelWriter writer(name, 1);
+    EXPECT_TRUE(writer.is_open());
+}
+
+TEST(SharedPoseChannel, foreign_segment_is_not_replaced)
+{
+    auto name = channel_name("foreign");
+    int fd    = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(0, ftruncate(fd, dbot::SharedPoseSegment::size(1)));
+    close(fd);
+
+    dbot::SharedPoseChannelWriter writer(name, 1);
+    EXPECT_FALSE(writer.is_open());
+
+    shm_unlink(name.c_str());
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,222 @@
+/*
+ * This is part of the Bayesian Object Tracking (bot),
+ * (https://github.com/bayesian-object-tracking)
+ *
+ * Copyright (c) 2026 dbot_ros contributors
+ *
+ * This Source Code Form is subject to the terms of the GNU General Public
+ * License License (GNU GPL). A copy of the license can be found in the LICENSE
+ * file distributed with this source code.
+ */
+
+/**
+ * \file tracking_result_file_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <dbot_ros/util/tracking_result_file.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+std::string temporary_file()
+{
+    char name[] = "/tmp/tracking_result_file_testXXXXXX";
+    int fd      = mkstemp(name);
+    if (fd >= 0) close(fd);
+    return name;
+}
+
+std::vector<dbot::TrackingResultRecord> make_records(
+    const dbot::TrackingResultLayout& layout,
+    size_t count)
+{
+    std::vector<dbot::TrackingResultRecord> records(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        records[i].stamp  = 100.0 + i / 30.0;
+        records[i].values = Eigen::VectorXd::LinSpaced(
+            layout.value_count(), i, i + 1.0 / (i + 1.0));
+    }
+    return records;
+}
+
+void write_records(const std::string& filename,
+                   const dbot::TrackingResultLayout& layout,
+                   const std::vector<dbot::TrackingResultRecord>& records,
+                   uint32_t block_records)
+{
+    dbot::TrackingResultWriter writer(filename, layout, block_records);
+    ASSERT_TRUE(writer.is_open());
+    for (auto& record : records) ASSERT_TRUE(writer.write(record));
+    ASSERT_TRUE(writer.close());
+}
+
+void overwrite(const std::string& filename, long offset, uint32_t value)
+{
+    std::fstream file(filename, std::ios::in | std::ios::out |
+                                    std::ios::binary);
+    file.seekp(offset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void truncate_file(const std::string& filename, long size)
+{
+    ASSERT_EQ(0, truncate(filename.c_str(), size));
+}
+}
+
+TEST(TrackingResultFile, round_trip_over_several_blocks)
+{
+    auto filename = temporary_file();
+    auto layout   = dbot::TrackingResultLayout(2, 6, 6, 3);
+    auto records  = make_records(layout, 11);
+    write_records(filename, layout, records, 4);
+
+    dbot::TrackingResultReader reader(filename);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_TRUE(reader.layout() == layout);
+    ASSERT_EQ(records.size(), reader.size());
+
+    std::vector<dbot::TrackingResultRecord> read_records;
+    ASSERT_TRUE(reader.read_all(read_records));
+    ASSERT_EQ(records.size(), read_records.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(records[i].stamp, read_records[i].stamp);
+        EXPECT_TRUE(records[i].values == read_records[i].values);
+    }
+
+    // random access into a full and into the incomplete last block
+    for (size_t i : {size_t(2), size_t(5), size_t(10)})
+    {
+        dbot::TrackingResultRecord record;
+        ASSERT_TRUE(reader.read(i, record));
+        EXPECT_EQ(records[i].stamp, record.stamp);
+        EXPECT_TRUE(records[i].values == record.values);
+    }
+
+    std::vector<double> column;
+    ASSERT_TRUE(reader.read_column(0, column));
+    ASSERT_EQ(records.size(), column.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(records[i].stamp, column[i]);
+    }
+
+    ASSERT_TRUE(reader.read_column(layout.value_count(), column));
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(records[i].values(layout.value_count() - 1), column[i]);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(TrackingResultFile, round_trip_of_object_states)
+{
+    auto filename = temporary_file();
+    auto layout   = dbot::TrackingResultLayout::object_states(2);
+
+    std::vector<dbot_ros_msgs::ObjectState> states(2);
+    states[0].pose.header.stamp.fromSec(12.5);
+    states[0].pose.pose.position.x     = 0.25;
+    states[0].pose.pose.orientation.w  = 1.0;
+    states[1].pose.pose.orientation.z  = 1.0;
+    states[1].velocity.twist.angular.y = -0.5;
+
+    {
+        dbot::TrackingResultWriter writer(filename, layout);
+        ASSERT_TRUE(writer.write(states));
+        ASSERT_TRUE(writer.close());
+    }
+
+    dbot::TrackingResultReader reader(filename);
+    dbot::TrackingResultRecord record;
+    ASSERT_EQ(1u, reader.size());
+    ASSERT_TRUE(reader.read(0, record));
+
+    auto read_states = reader.to_object_states(record);
+    ASSERT_EQ(2u, read_states.size());
+    EXPECT_EQ(12.5, read_states[1].pose.header.stamp.toSec());
+    EXPECT_EQ(0.25, read_states[0].pose.pose.position.x);
+    EXPECT_EQ(1.0, read_states[0].pose.pose.orientation.w);
+    EXPECT_EQ(1.0, read_states[1].pose.pose.orientation.z);
+    EXPECT_EQ(-0.5, read_states[1].velocity.twist.angular.y);
+
+    std::remove(filename.c_str());
+}
+
+TEST(TrackingResultFile, rejects_other_byte_order)
+{
+    auto filename = temporary_file();
+    auto layout   = dbot::TrackingResultLayout(1, 6, 0, 0);
+    write_records(filename, layout, make_records(layout, 3), 4);
+
+    // byte order marker at offset 8
+    overwrite(filename, 8, 0x04030201);
+
+    dbot::TrackingResultReader reader(filename);
+    EXPECT_FALSE(reader.is_open());
+
+    std::remove(filename.c_str());
+}
+
+TEST(TrackingResultFile, corrupt_counts_are_bounded_by_the_file_size)
+{
+    auto filename = temporary_file();
+    auto layout   = dbot::TrackingResultLayout(1, 6, 0, 0);
+    write_records(filename, layout, make_records(layout, 3), 4);
+
+    // an object count of 2^32 - 1 must not be allocated
+    overwrite(filename, 12, 0xffffffff);
+
+    dbot::TrackingResultReader reader(filename);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_EQ(0u, reader.size());
+
+    dbot::TrackingResultRecord record;
+    EXPECT_FALSE(reader.read(0, record));
+
+    std::vector<dbot::TrackingResultRecord> records;
+    EXPECT_TRUE(reader.read_all(records));
+    EXPECT_TRUE(records.empty());
+
+    std::remove(filename.c_str());
+}
+
+TEST(TrackingResultFile, truncated_last_block_is_ignored)
+{
+    auto filename = temporary_file();
+    auto layout   = dbot::TrackingResultLayout(1, 6, 0, 0);
+    auto records  = make_records(layout, 6);
+    write_records(filename, layout, records, 4);
+
+    // header, one complete block of 4 records, a block of 2 records
+    const long block_bytes = 8 + 4 * layout.record_bytes();
+    truncate_file(filename, 32 + block_bytes + 8 + layout.record_bytes());
+
+    dbot::TrackingResultReader reader(filename);
+    ASSERT_TRUE(reader.is_open());
+    ASSERT_EQ(4u, reader.size());
+
+    std::vector<dbot::TrackingResultRecord> read_records;
+    ASSERT_TRUE(reader.read_all(read_records));
+    EXPECT_EQ(records[3].stamp, read_records[3].stamp);
+    EXPECT_TRUE(records[3].values == read_records[3].values);
+
+    std::remove(filename.c_str());
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}